@@ -28,230 +28,825 @@
 #ifndef _HYBRID_SORT_HPP_
 #define _HYBRID_SORT_HPP_
 #include "include/DualPivotQuickSort.hpp"
+#include "include/VectorizedQuickSort.hpp"
 #include "include/RadixSort.hpp"
+#include "include/ParallelRadixSort.hpp"
+#include "include/ArgSort.hpp"
+#include "include/PairSort.hpp"
 #include <algorithm>
+#include <cstdint>
 #include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <type_traits>
 #include <vector>
 
 namespace HybridSort {
+    /**
+     * If the length of an array of composite keys to be sorted is greater
+     * than this constant, radix sort is used in preference to Dual-Pivot
+     * Quicksort, which cannot vectorize their comparisons.
+     */
+    const int COMPOSITE_RADIX_SORT_THRESHOLD = 256;
+
+    /**
+     * Returns the length of arrays of T above which radix sort is used in
+     * preference to dual pivot quick sort. Wider keys take more radix
+     * passes and need longer arrays to pay off.
+     */
     template <typename T>
-    void sort(T begin, T end) {
-        std::sort(begin, end);
+    inline Index radixSortThreshold() {
+        if (IsCompositeKey<T>::value) return COMPOSITE_RADIX_SORT_THRESHOLD;
+        return profile().radixSortThreshold[sizeof(T) == 1   ? 0
+                                            : sizeof(T) == 2 ? 1
+                                            : sizeof(T) == 4 ? 2
+                                                             : 3];
     }
 
-    template <>
-    void sort<float *>(float *begin, float *end) {
-        if (end - begin <= 10000000) {
-            dualPivotQuickSort(begin, end);
+    /**
+     * Tag which asks sort to use O(log n) extra memory instead of
+     * O(n) scratch buffers.
+     */
+    struct BoundedMemory {};
+
+    /**
+     * Checks if the iterator is a class which only wraps a pointer, as the
+     * iterators of std::vector, std::basic_string and std::span are.
+     */
+    template <typename T>
+    struct IsPointerWrapper : std::false_type {};
+
+#if defined(__GLIBCXX__)
+    template <typename P, typename C>
+    struct IsPointerWrapper<__gnu_cxx::__normal_iterator<P, C> > : std::is_pointer<P> {};
+#elif defined(_LIBCPP_VERSION)
+    template <typename P>
+    struct IsPointerWrapper<std::__wrap_iter<P> > : std::is_pointer<P> {};
+#endif
+
+    /**
+     * Checks if the elements of an iterator range are stored contiguously,
+     * so that the range can be sorted as a plain array.
+     */
+    template <typename T>
+    struct IsContiguousIterator {
+        using V = typename std::iterator_traits<T>::value_type;
+        static const bool value =
+            std::is_pointer<T>::value || IsPointerWrapper<T>::value ||
+            (!std::is_same<V, bool>::value &&
+             std::is_same<T, typename std::vector<V>::iterator>::value);
+    };
+
+    /**
+     * Checks if arrays of T can be sorted by Dual-Pivot Quicksort, which
+     * copies elements into temporaries and creates its merge buffer by
+     * new T[]. Other types are sorted by std::sort, which only moves them.
+     */
+    template <typename T>
+    struct IsQuickSortable
+        : std::integral_constant<bool, IsPrimitiveKey<T>::value || IsCompositeKey<T>::value ||
+                                           (std::is_trivially_copyable<T>::value &&
+                                            std::is_default_constructible<T>::value)> {};
+
+    template <typename T>
+    void sortAscending(T *a, Index n, std::true_type) {
+        // Keys of few distinct values are counted instead of compared
+        if (narrowRangeSort(a, n)) return;
+        if (n <= radixSortThreshold<T>()) {
+            vectorizedQuickSort(a, a + n);
             return;
         }
-        std::sort(begin, end);
+        // Merge nearly sorted arrays instead of sorting them digit by digit
+        if (!mergeRuns(a, 0, n - 1, (T *) nullptr, 0, 0, 0, std::less<T>())) radixSort(a, n);
     }
 
-    template <>
-    void sort<std::vector<float>::iterator>(std::vector<float>::iterator begin,
-                                            std::vector<float>::iterator end) {
-        if (end - begin <= 10000000) {
-            dualPivotQuickSort(begin, end);
+    template <typename T, typename Comp>
+    void sortFields(T *a, Index n, Comp cmp, std::true_type) {
+        if (n <= radixSortThreshold<T>()) {
+            dualPivotQuickSort(a, a + n, cmp);
             return;
         }
-        std::sort(begin, end);
+        using Key = typename std::conditional<IsGreaterCompare<Comp, T>::value,
+                                              DescendingRadixKey<PrefixRadixKey<T> >,
+                                              PrefixRadixKey<T> >::type;
+        if (!mergeRuns(a, 0, n - 1, (T *) nullptr, 0, 0, 0, cmp))
+            prefixRadixSort<T, Key>(a, n, cmp);
     }
 
-    template <>
-    void sort<double *>(double *begin, double *end) {
-        if (end - begin <= 10000000) {
-            dualPivotQuickSort(begin, end);
-            return;
-        }
-        std::sort(begin, end);
+    template <typename T, typename Comp>
+    void sortFields(T *a, Index n, Comp cmp, std::false_type) {
+        vectorizedQuickSort(a, a + n, cmp);
     }
 
-    template <>
-    void sort<std::vector<double>::iterator>(std::vector<double>::iterator begin,
-                                             std::vector<double>::iterator end) {
-        if (end - begin <= 10000000) {
-            dualPivotQuickSort(begin, end);
-            return;
-        }
-        std::sort(begin, end);
+    template <typename T>
+    void sortAscending(T *a, Index n, std::false_type) {
+        sortFields(a, n, std::less<T>(), std::integral_constant<bool, IsCompositeKey<T>::value>());
     }
 
-    template <>
-    void sort<long double *>(long double *begin, long double *end) {
-        if (end - begin <= 10000000) {
-            dualPivotQuickSort(begin, end);
-            return;
-        }
-        std::sort(begin, end);
+    template <typename T>
+    void sort(T begin, T end, std::true_type) {
+        using V = typename std::iterator_traits<T>::value_type;
+        if (end - begin < 2) return;
+        sortAscending(&(*begin), end - begin,
+                      std::integral_constant<bool, HasRadixKey<V>::value>());
     }
 
-    template <>
-    void sort<std::vector<long double>::iterator>(std::vector<long double>::iterator begin,
-                                                  std::vector<long double>::iterator end) {
-        if (end - begin <= 10000000) {
-            dualPivotQuickSort(begin, end);
-            return;
-        }
+    template <typename T>
+    void sort(T begin, T end, std::false_type) {
         std::sort(begin, end);
     }
 
-    template <>
-    void sort<long long *>(long long *begin, long long *end) {
-        if (end - begin <= 10000000) {
-            dualPivotQuickSort(begin, end);
-            return;
-        }
-        std::sort(begin, end);
+    /**
+     * Sorts the range in ascending order. Contiguous ranges of integral,
+     * floating-point and enumeration types are sorted by the vectorized
+     * Dual-Pivot Quicksort, and by radix sort when they are long. Pairs
+     * and tuples of them are sorted by Dual-Pivot Quicksort, and by radix
+     * sort on all their fields when they are long. Other ranges are sorted
+     * by std::sort.
+     *
+     * @param begin the beginning of the range
+     * @param end the end of the range
+     */
+    template <typename T>
+    void sort(T begin, T end) {
+        using V = typename std::iterator_traits<T>::value_type;
+        HybridSort::sort(begin, end,
+                         std::integral_constant<bool, IsContiguousIterator<T>::value &&
+                                                          (IsPrimitiveKey<V>::value ||
+                                                           IsCompositeKey<V>::value)>());
     }
 
-    template <>
-    void sort<std::vector<long long>::iterator>(std::vector<long long>::iterator begin,
-                                                std::vector<long long>::iterator end) {
-        if (end - begin <= 10000000) {
-            dualPivotQuickSort(begin, end);
+    template <typename T>
+    void sortDescending(T *a, Index n, std::true_type) {
+        if (narrowRangeSort<T, DescendingRadixKey<RadixKey<T> > >(a, n)) return;
+        if (n <= radixSortThreshold<T>()) {
+            vectorizedQuickSort(a, a + n, std::greater<T>());
             return;
         }
-        std::sort(begin, end);
+        if (!mergeRuns(a, 0, n - 1, (T *) nullptr, 0, 0, 0, std::greater<T>()))
+            descendingRadixSort(a, n);
     }
 
-    template <>
-    void sort<unsigned long long *>(unsigned long long *begin, unsigned long long *end) {
-        if (end - begin <= 10000000) {
-            dualPivotQuickSort(begin, end);
-            return;
-        }
-        std::sort(begin, end);
+    template <typename T>
+    void sortDescending(T *a, Index n, std::false_type) {
+        sortFields(a, n, std::greater<T>(),
+                   std::integral_constant<bool, IsCompositeKey<T>::value>());
     }
 
-    template <>
-    void sort<std::vector<unsigned long long>::iterator>(
-        std::vector<unsigned long long>::iterator begin,
-        std::vector<unsigned long long>::iterator end) {
-        if (end - begin <= 10000000) {
-            dualPivotQuickSort(begin, end);
-            return;
-        }
+    template <typename T, typename Comp>
+    void sortArray(T *a, Index n, Comp, std::true_type) {
+        sortDescending(a, n, std::integral_constant<bool, HasRadixKey<T>::value>());
+    }
+
+    template <typename T, typename Comp>
+    void sortArray(T *a, Index n, Comp cmp, std::false_type) {
+        vectorizedQuickSort(a, a + n, cmp);
+    }
+
+    template <typename T, typename Comp>
+    void sortRange(T begin, T end, Comp cmp, std::true_type) {
+        using V = typename std::iterator_traits<T>::value_type;
+        if (end - begin < 2) return;
+        sortArray(&(*begin), end - begin, cmp,
+                  std::integral_constant<bool, IsGreaterCompare<Comp, V>::value>());
+    }
+
+    template <typename T, typename Comp>
+    void sortRange(T begin, T end, Comp cmp, std::false_type) {
+        std::sort(begin, end, cmp);
+    }
+
+    template <typename T, typename Comp>
+    void sortBy(T begin, T end, Comp, std::true_type) {
+        HybridSort::sort(begin, end);
+    }
+
+    template <typename T, typename Comp>
+    void sortBy(T begin, T end, Comp cmp, std::false_type) {
+        using V = typename std::iterator_traits<T>::value_type;
+        sortRange(begin, end, cmp,
+                  std::integral_constant<bool, IsContiguousIterator<T>::value &&
+                                                   IsQuickSortable<V>::value>());
+    }
+
+    /**
+     * Sorts the range in the order of the comparator. std::less and
+     * std::greater on primitive keys are detected at compile time and take
+     * the same vectorized and radix sort paths as sort(begin, end), radix
+     * sort emitting descending order directly. Other comparators on
+     * contiguous ranges of plain data are sorted by Dual-Pivot Quicksort,
+     * and all other ranges by std::sort.
+     */
+    template <typename T, typename Comp>
+    void sort(T begin, T end, Comp cmp) {
+        using V = typename std::iterator_traits<T>::value_type;
+        sortBy(begin, end, cmp, std::integral_constant<bool, IsLessCompare<Comp, V>::value>());
+    }
+
+    template <typename T>
+    void sort(T begin, T end, BoundedMemory, std::true_type) {
+        if (end - begin < 2) return;
+        inPlaceRadixSort(&(*begin), end - begin);
+    }
+
+    template <typename T>
+    void sort(T begin, T end, BoundedMemory, std::false_type) {
         std::sort(begin, end);
     }
 
-    template <>
-    void sort<char *>(char *begin, char *end) {
-        if (end - begin <= 1024) {
-            dualPivotQuickSort(begin, end);
-            return;
-        }
-        radixSort(begin, end - begin);
+    template <typename T>
+    void sort(T begin, T end, BoundedMemory tag) {
+        HybridSort::sort(begin, end, tag,
+                         std::integral_constant<bool, IsContiguousIterator<T>::value>());
     }
 
-    template <>
-    void sort<std::vector<char>::iterator>(std::vector<char>::iterator begin,
-                                           std::vector<char>::iterator end) {
-        if (end - begin <= 1024) {
-            dualPivotQuickSort(begin, end);
-            return;
+    /**
+     * If the length of an array of floating-point keys to be sorted stably
+     * is greater than this constant, LSD radix sort is used in preference
+     * to merge sort.
+     */
+    const int STABLE_RADIX_SORT_THRESHOLD = 128;
+
+    template <typename T, typename Comp>
+    void stableSortKeys(T *a, Index n, Comp cmp, std::true_type) {
+        if (n <= STABLE_RADIX_SORT_THRESHOLD) {
+            mergeSort(a, n, cmp);
+        } else if (!mergeRuns(a, 0, n - 1, (T *) nullptr, 0, 0, 0, cmp)) {
+            if (IsGreaterCompare<Comp, T>::value) {
+                adaptiveRadixSort<T, DescendingRadixKey<StableRadixKey<T> > >(a, n);
+            } else {
+                adaptiveRadixSort<T, StableRadixKey<T> >(a, n);
+            }
         }
-        radixSort(&(*begin), end - begin);
     }
 
-    template <>
-    void sort<unsigned char *>(unsigned char *begin, unsigned char *end) {
-        if (end - begin <= 1024) {
-            dualPivotQuickSort(begin, end);
-            return;
+    template <typename T, typename Comp>
+    void stableSortKeys(T *a, Index n, Comp, std::false_type) {
+        // Equal integral and enumeration keys are identical, so the unstable sort is stable
+        if (IsGreaterCompare<Comp, T>::value) {
+            sortDescending(a, n, std::integral_constant<bool, HasRadixKey<T>::value>());
+        } else {
+            sortAscending(a, n, std::integral_constant<bool, HasRadixKey<T>::value>());
         }
-        radixSort(begin, end - begin);
     }
 
-    template <>
-    void sort<std::vector<unsigned char>::iterator>(std::vector<unsigned char>::iterator begin,
-                                                    std::vector<unsigned char>::iterator end) {
-        if (end - begin <= 1024) {
-            dualPivotQuickSort(begin, end);
-            return;
-        }
-        radixSort(&(*begin), end - begin);
+    template <typename T, typename Comp>
+    void stableSortArray(T *a, Index n, Comp cmp, std::true_type) {
+        stableSortKeys(a, n, cmp,
+                       std::integral_constant<bool, std::is_floating_point<T>::value &&
+                                                        HasRadixKey<T>::value>());
     }
 
-    template <>
-    void sort<short *>(short *begin, short *end) {
-        if (end - begin <= 1048576) {
-            dualPivotQuickSort(begin, end);
-            return;
+    template <typename T, typename Comp>
+    void stableSortArray(T *a, Index n, Comp cmp, std::false_type) {
+        mergeSort(a, n, cmp);
+    }
+
+    template <typename T, typename Comp>
+    void stable_sort(T begin, T end, Comp cmp, std::true_type) {
+        using V = typename std::iterator_traits<T>::value_type;
+        if (end - begin < 2) return;
+        // Floating-point keys without a radix key, as long double, are merge sorted, since
+        // zeros of both signs compare equal
+        const bool keys = IsPrimitiveKey<V>::value &&
+                          (HasRadixKey<V>::value || !std::is_floating_point<V>::value) &&
+                          (IsLessCompare<Comp, V>::value || IsGreaterCompare<Comp, V>::value);
+        stableSortArray(&(*begin), end - begin, cmp, std::integral_constant<bool, keys>());
+    }
+
+    template <typename T, typename Comp>
+    void stable_sort(T begin, T end, Comp cmp, std::false_type) {
+        std::stable_sort(begin, end, cmp);
+    }
+
+    /**
+     * Sorts the range in the order of the comparator, keeping the order of
+     * equal elements. Contiguous ranges are sorted by an adaptive merge sort,
+     * which merges the runs of nearly sorted ranges in O(n) time, and
+     * floating-point keys ordered by std::less or std::greater by stable LSD
+     * radix sort when they are long. Other ranges are sorted by
+     * std::stable_sort.
+     *
+     * @param begin the beginning of the range
+     * @param end the end of the range
+     * @param cmp the comparator
+     */
+    template <typename T, typename Comp>
+    void stable_sort(T begin, T end, Comp cmp) {
+        using V = typename std::iterator_traits<T>::value_type;
+        // The merge buffer is created by new V[], which needs a default constructor
+        const bool mergeable =
+            IsContiguousIterator<T>::value && std::is_default_constructible<V>::value;
+        HybridSort::stable_sort(begin, end, cmp, std::integral_constant<bool, mergeable>());
+    }
+
+    /**
+     * Sorts the range in ascending order, keeping the order of equal
+     * elements, as stable_sort(begin, end, std::less<>()) does.
+     *
+     * @param begin the beginning of the range
+     * @param end the end of the range
+     */
+    template <typename T>
+    void stable_sort(T begin, T end) {
+        HybridSort::stable_sort(begin, end,
+                                std::less<typename std::iterator_traits<T>::value_type>());
+    }
+
+    /**
+     * If the length of an array of floating-point keys to select from is
+     * less than this constant, Dual-Pivot Quicksort selection is used in
+     * preference to radix select, whose first digits hardly split keys of
+     * similar magnitude.
+     */
+    const int FLOATING_RADIX_SELECT_THRESHOLD = 65536;
+
+    template <typename T, typename Comp>
+    void selectArray(T *a, Index n, Index k, Comp cmp, std::true_type) {
+        if (std::is_floating_point<T>::value && n < FLOATING_RADIX_SELECT_THRESHOLD) {
+            dualPivotSelect(a, 0, n - 1, k, true, cmp);
+        } else if (IsGreaterCompare<Comp, T>::value) {
+            radixSelect<T, DescendingRadixKey<RadixKey<T> > >(a, n, k, cmp);
+        } else {
+            radixSelect<T, RadixKey<T> >(a, n, k, cmp);
         }
-        radixSort(begin, end - begin);
     }
 
-    template <>
-    void sort<std::vector<short>::iterator>(std::vector<short>::iterator begin,
-                                            std::vector<short>::iterator end) {
-        if (end - begin <= 1048576) {
-            dualPivotQuickSort(begin, end);
+    template <typename T, typename Comp>
+    void selectArray(T *a, Index n, Index k, Comp cmp, std::false_type) {
+        dualPivotSelect(a, 0, n - 1, k, true, cmp);
+    }
+
+    template <typename T, typename Comp>
+    void nth_element(T begin, T nth, T end, Comp cmp, std::true_type) {
+        using V = typename std::iterator_traits<T>::value_type;
+        if (end - begin < 2 || nth >= end) return;
+        selectArray(&(*begin), end - begin, nth - begin, cmp,
+                    std::integral_constant<bool, HasRadixKey<V>::value &&
+                                                     (IsLessCompare<Comp, V>::value ||
+                                                      IsGreaterCompare<Comp, V>::value)>());
+    }
+
+    template <typename T, typename Comp>
+    void nth_element(T begin, T nth, T end, Comp cmp, std::false_type) {
+        std::nth_element(begin, nth, end, cmp);
+    }
+
+    /**
+     * Rearranges the range so that *nth is the element which would be there
+     * if the range was sorted in the order of the comparator, no element
+     * before it is greater and no element after it is less, in O(n) expected
+     * time. Contiguous ranges of integral and enumeration keys, and long
+     * ones of floating-point keys, ordered by std::less or std::greater are
+     * selected from by radix select, other contiguous ranges of plain data
+     * by Dual-Pivot Quicksort partitioning, and other ranges by
+     * std::nth_element.
+     *
+     * @param begin the beginning of the range
+     * @param nth the position of the element to be selected
+     * @param end the end of the range
+     * @param cmp the comparator
+     */
+    template <typename T, typename Comp>
+    void nth_element(T begin, T nth, T end, Comp cmp) {
+        using V = typename std::iterator_traits<T>::value_type;
+        HybridSort::nth_element(begin, nth, end, cmp,
+                                std::integral_constant<bool, IsContiguousIterator<T>::value &&
+                                                                 IsQuickSortable<V>::value>());
+    }
+
+    /**
+     * Rearranges the range so that *nth is the element which would be there
+     * if the range was sorted in ascending order, as
+     * nth_element(begin, nth, end, std::less<>()) does.
+     *
+     * @param begin the beginning of the range
+     * @param nth the position of the element to be selected
+     * @param end the end of the range
+     */
+    template <typename T>
+    void nth_element(T begin, T nth, T end) {
+        HybridSort::nth_element(begin, nth, end,
+                                std::less<typename std::iterator_traits<T>::value_type>());
+    }
+
+    /**
+     * If at most 1 / HEAP_SELECT_RATIO of the elements of a range are to be
+     * sorted by partial_sort, they are selected by std::partial_sort, which
+     * scans the range past a heap of them and rarely updates it, in
+     * preference to nth_element.
+     */
+    const int HEAP_SELECT_RATIO = 256;
+
+    /**
+     * Sorts the smallest middle - begin elements of the range in the order
+     * of the comparator into [begin, middle), leaving the other elements in
+     * [middle, end) in unspecified order. They are selected by nth_element
+     * and then sorted, which takes O(n + k log k) time for k of them, or by
+     * a heap if they are very few.
+     *
+     * @param begin the beginning of the range
+     * @param middle the end of the elements to be sorted
+     * @param end the end of the range
+     * @param cmp the comparator
+     */
+    template <typename T, typename Comp>
+    void partial_sort(T begin, T middle, T end, Comp cmp) {
+        if (middle == begin) return;
+        if (std::distance(begin, middle) <= std::distance(begin, end) / HEAP_SELECT_RATIO) {
+            std::partial_sort(begin, middle, end, cmp);
             return;
         }
-        radixSort(&(*begin), end - begin);
+        if (middle != end) HybridSort::nth_element(begin, middle, end, cmp);
+        HybridSort::sort(begin, middle, cmp);
     }
 
-    template <>
-    void sort<unsigned short *>(unsigned short *begin, unsigned short *end) {
-        if (end - begin <= 1048576) {
-            dualPivotQuickSort(begin, end);
-            return;
+    /**
+     * Sorts the smallest middle - begin elements of the range in ascending
+     * order into [begin, middle), as partial_sort(begin, middle, end,
+     * std::less<>()) does.
+     *
+     * @param begin the beginning of the range
+     * @param middle the end of the elements to be sorted
+     * @param end the end of the range
+     */
+    template <typename T>
+    void partial_sort(T begin, T middle, T end) {
+        HybridSort::partial_sort(begin, middle, end,
+                                 std::less<typename std::iterator_traits<T>::value_type>());
+    }
+
+    /**
+     * Moves the k greatest elements of the range in the order of the
+     * comparator to its beginning, sorted from the greatest one down, as a
+     * leaderboard lists them. The other elements are left in unspecified
+     * order.
+     *
+     * @param begin the beginning of the range
+     * @param end the end of the range
+     * @param k the number of elements to be listed, all of them if k is
+     *          greater than the length of the range
+     * @param cmp the comparator
+     * @return the end of the k greatest elements
+     */
+    template <typename T, typename Comp>
+    T top_k(T begin, T end, typename std::iterator_traits<T>::difference_type k, Comp cmp) {
+        T middle = k < std::distance(begin, end) ? std::next(begin, k) : end;
+        HybridSort::partial_sort(begin, middle, end, reverseCompare(cmp));
+        return middle;
+    }
+
+    /**
+     * Moves the k largest elements of the range to its beginning in
+     * descending order, as top_k(begin, end, k, std::less<>()) does.
+     *
+     * @param begin the beginning of the range
+     * @param end the end of the range
+     * @param k the number of elements to be listed
+     * @return the end of the k largest elements
+     */
+    template <typename T>
+    T top_k(T begin, T end, typename std::iterator_traits<T>::difference_type k) {
+        return HybridSort::top_k(begin, end, k,
+                                 std::less<typename std::iterator_traits<T>::value_type>());
+    }
+
+    /**
+     * If the length of an array to be argsorted is greater than this
+     * constant, its keys and indices are sorted by radix sort in preference
+     * to Dual-Pivot Quicksort.
+     */
+    const int RADIX_ARGSORT_THRESHOLD = 256;
+
+    template <typename I, typename T, typename O, typename Comp>
+    void argsortIndices(T begin, Index n, O out, Comp, std::true_type) {
+        using V = typename std::iterator_traits<T>::value_type;
+        if (IsGreaterCompare<Comp, V>::value) {
+            radixArgsort<DescendingRadixKey<StableRadixKey<V> >, I>(begin, n, out,
+                                                                     RADIX_ARGSORT_THRESHOLD);
+        } else {
+            radixArgsort<StableRadixKey<V>, I>(begin, n, out, RADIX_ARGSORT_THRESHOLD);
         }
-        radixSort(begin, end - begin);
     }
 
-    template <>
-    void sort<std::vector<unsigned short>::iterator>(std::vector<unsigned short>::iterator begin,
-                                                     std::vector<unsigned short>::iterator end) {
-        if (end - begin <= 1048576) {
-            dualPivotQuickSort(begin, end);
-            return;
+    template <typename I, typename T, typename O, typename Comp>
+    void argsortIndices(T begin, Index n, O out, Comp cmp, std::false_type) {
+        comparisonArgsort<I>(begin, n, out, cmp);
+    }
+
+    /**
+     * Writes to out the permutation of indices which sorts the range in the
+     * order of the comparator, without moving the elements, so that several
+     * columns can be reordered the same way. The indices of equal elements
+     * are in ascending order. Primitive keys ordered by std::less or
+     * std::greater are sorted together with their indices by radix sort,
+     * other elements by Dual-Pivot Quicksort over their indices. The indices
+     * are sorted as 32-bit integers unless the range is longer.
+     *
+     * @param begin the beginning of the range
+     * @param end the end of the range
+     * @param out the beginning of the end - begin indices to be written
+     * @param cmp the comparator
+     */
+    template <typename T, typename O, typename Comp>
+    void argsort(T begin, T end, O out, Comp cmp) {
+        using V = typename std::iterator_traits<T>::value_type;
+        using Radix = std::integral_constant<bool, HasRadixKey<V>::value &&
+                                                       (IsLessCompare<Comp, V>::value ||
+                                                        IsGreaterCompare<Comp, V>::value)>;
+        const Index n = end - begin;
+        if (n <= 0) return;
+        if (static_cast<std::uint64_t>(n) <= std::numeric_limits<std::uint32_t>::max()) {
+            argsortIndices<std::uint32_t>(begin, n, out, cmp, Radix());
+        } else {
+            argsortIndices<std::uint64_t>(begin, n, out, cmp, Radix());
         }
-        radixSort(&(*begin), end - begin);
     }
 
-    template <>
-    void sort<int *>(int *begin, int *end) {
-        if (end - begin <= 2097152) {
-            dualPivotQuickSort(begin, end);
-            return;
+    /**
+     * Writes to out the permutation of indices which sorts the range in
+     * ascending order, as argsort(begin, end, out, std::less<>()) does.
+     *
+     * @param begin the beginning of the range
+     * @param end the end of the range
+     * @param out the beginning of the end - begin indices to be written
+     */
+    template <typename T, typename O>
+    void argsort(T begin, T end, O out) {
+        HybridSort::argsort(begin, end, out,
+                            std::less<typename std::iterator_traits<T>::value_type>());
+    }
+
+    template <typename I, typename V, typename Proj, typename Comp>
+    void sortByKeyIndices(V *a, Index n, Proj proj, Comp) {
+        using K = typename std::decay<decltype(proj(*a))>::type;
+        if (IsGreaterCompare<Comp, K>::value) {
+            radixSortByKey<DescendingRadixKey<StableRadixKey<K> >, I>(a, n, proj,
+                                                                       RADIX_ARGSORT_THRESHOLD);
+        } else {
+            radixSortByKey<StableRadixKey<K>, I>(a, n, proj, RADIX_ARGSORT_THRESHOLD);
         }
-        radixSort(begin, end - begin);
     }
 
-    template <>
-    void sort<std::vector<int>::iterator>(std::vector<int>::iterator begin,
-                                          std::vector<int>::iterator end) {
-        if (end - begin <= 2097152) {
-            dualPivotQuickSort(begin, end);
-            return;
+    template <typename T, typename Proj, typename Comp>
+    void sort_by_key(T begin, T end, Proj proj, Comp cmp, std::true_type) {
+        const Index n = end - begin;
+        if (n < 2) return;
+        if (static_cast<std::uint64_t>(n) <= std::numeric_limits<std::uint32_t>::max()) {
+            sortByKeyIndices<std::uint32_t>(&(*begin), n, proj, cmp);
+        } else {
+            sortByKeyIndices<std::uint64_t>(&(*begin), n, proj, cmp);
         }
-        radixSort(&(*begin), end - begin);
     }
 
-    template <>
-    void sort<unsigned int *>(unsigned int *begin, unsigned int *end) {
-        if (end - begin <= 2097152) {
-            dualPivotQuickSort(begin, end);
-            return;
+    template <typename T, typename Proj, typename Comp>
+    void sort_by_key(T begin, T end, Proj proj, Comp cmp, std::false_type) {
+        using V = typename std::iterator_traits<T>::value_type;
+        HybridSort::stable_sort(begin, end, [proj, cmp](const V &x, const V &y) {
+            return cmp(proj(x), proj(y));
+        });
+    }
+
+    /**
+     * Sorts the range stably by the keys the projection returns for its
+     * elements, in the order of the comparator of the keys. If the keys are
+     * primitive and ordered by std::less or std::greater, they are sorted
+     * with the indices of their elements by the argsort engines, and then
+     * the elements are moved into place, so large records are moved only
+     * twice. Other ranges are sorted by stable_sort.
+     *
+     * @param begin the beginning of the range
+     * @param end the end of the range
+     * @param proj the projection of the elements to their keys
+     * @param cmp the comparator of the keys
+     */
+    template <typename T, typename Proj, typename Comp>
+    void sort_by_key(T begin, T end, Proj proj, Comp cmp) {
+        using V = typename std::iterator_traits<T>::value_type;
+        using K = typename std::decay<decltype(proj(*begin))>::type;
+        // The elements are moved through a buffer created by new V[]
+        const bool radix = IsContiguousIterator<T>::value &&
+                           std::is_default_constructible<V>::value && HasRadixKey<K>::value &&
+                           (IsLessCompare<Comp, K>::value || IsGreaterCompare<Comp, K>::value);
+        HybridSort::sort_by_key(begin, end, proj, cmp, std::integral_constant<bool, radix>());
+    }
+
+    /**
+     * Sorts the range stably by the keys the projection returns for its
+     * elements in ascending order, as sort_by_key(begin, end, proj,
+     * std::less<>()) does.
+     *
+     * @param begin the beginning of the range
+     * @param end the end of the range
+     * @param proj the projection of the elements to their keys
+     */
+    template <typename T, typename Proj>
+    void sort_by_key(T begin, T end, Proj proj) {
+        HybridSort::sort_by_key(begin, end, proj,
+                                std::less<typename std::decay<decltype(proj(*begin))>::type>());
+    }
+
+    /**
+     * If the number of pairs to be sorted is greater than this constant
+     * times the size of the keys in bytes, the keys and values are sorted
+     * by radix sort in preference to Dual-Pivot Quicksort. Wider keys take
+     * more radix passes.
+     */
+    const int RADIX_SORT_PAIRS_THRESHOLD = 128;
+
+    template <typename T, typename U, typename Comp>
+    void argsortPairs(T keysBegin, T keysEnd, U valuesBegin, Comp cmp) {
+        const Index n = keysEnd - keysBegin;
+        std::unique_ptr<Index[]> order(new Index[n]);
+        HybridSort::argsort(keysBegin, keysEnd, order.get(), cmp);
+        permutePairs(keysBegin, valuesBegin, order.get(), n);
+    }
+
+    template <typename K, typename V, typename Comp>
+    void sortShortPairs(K *keys, V *values, Index n, Comp cmp, std::true_type) {
+        quickSortPairs(keys, values, n, cmp);
+    }
+
+    template <typename K, typename V, typename Comp>
+    void sortShortPairs(K *keys, V *values, Index n, Comp cmp, std::false_type) {
+        argsortPairs(keys, keys + n, values, cmp);
+    }
+
+    template <typename T, typename U, typename Comp>
+    void sort_pairs(T keysBegin, T keysEnd, U valuesBegin, Comp cmp, std::true_type) {
+        using K = typename std::iterator_traits<T>::value_type;
+        using V = typename std::iterator_traits<U>::value_type;
+        const Index n = keysEnd - keysBegin;
+        if (n < 2) return;
+        K *keys = &(*keysBegin);
+        V *values = &(*valuesBegin);
+        if (n <= RADIX_SORT_PAIRS_THRESHOLD * static_cast<Index>(sizeof(K))) {
+            // Dual-Pivot Quicksort copies the zipped pairs, so only plain values are zipped
+            sortShortPairs(keys, values, n, cmp,
+                           std::integral_constant<bool, IsQuickSortable<V>::value>());
+        } else if (IsGreaterCompare<Comp, K>::value) {
+            radixSortPairs<K, V, DescendingRadixKey<RadixKey<K> > >(keys, values, n);
+        } else {
+            radixSortPairs(keys, values, n);
         }
-        radixSort(begin, end - begin);
     }
 
-    template <>
-    void sort<std::vector<unsigned int>::iterator>(std::vector<unsigned int>::iterator begin,
-                                                   std::vector<unsigned int>::iterator end) {
-        if (end - begin <= 2097152) {
-            dualPivotQuickSort(begin, end);
+    template <typename T, typename U, typename Comp>
+    void sort_pairs(T keysBegin, T keysEnd, U valuesBegin, Comp cmp, std::false_type) {
+        if (keysEnd - keysBegin < 2) return;
+        argsortPairs(keysBegin, keysEnd, valuesBegin, cmp);
+    }
+
+    /**
+     * Sorts the keys in the order of the comparator, and reorders the values
+     * starting at valuesBegin the same way, so that each value stays with
+     * its key. The order of the values of equal keys is unspecified.
+     *
+     * If the keys are primitive and ordered by std::less or std::greater,
+     * and both ranges are contiguous, the keys are radix sorted and each
+     * scatter pass moves the values along with them; short arrays with
+     * plain values are sorted by Dual-Pivot Quicksort swapping keys and
+     * values together, and with other values argsorted. Otherwise the keys are argsorted and both ranges are permuted in place.
+     *
+     * @param keysBegin the beginning of the keys
+     * @param keysEnd the end of the keys
+     * @param valuesBegin the beginning of the keysEnd - keysBegin values
+     * @param cmp the comparator of the keys
+     */
+    template <typename T, typename U, typename Comp>
+    void sort_pairs(T keysBegin, T keysEnd, U valuesBegin, Comp cmp) {
+        using K = typename std::iterator_traits<T>::value_type;
+        using V = typename std::iterator_traits<U>::value_type;
+        // The values are moved through buffers created by new V[]
+        const bool radix = IsContiguousIterator<T>::value && IsContiguousIterator<U>::value &&
+                           std::is_default_constructible<V>::value && HasRadixKey<K>::value &&
+                           (IsLessCompare<Comp, K>::value || IsGreaterCompare<Comp, K>::value);
+        HybridSort::sort_pairs(keysBegin, keysEnd, valuesBegin, cmp,
+                               std::integral_constant<bool, radix>());
+    }
+
+    /**
+     * Sorts the keys in ascending order, and reorders the values the same
+     * way, as sort_pairs(keysBegin, keysEnd, valuesBegin, std::less<>()) does.
+     *
+     * @param keysBegin the beginning of the keys
+     * @param keysEnd the end of the keys
+     * @param valuesBegin the beginning of the keysEnd - keysBegin values
+     */
+    template <typename T, typename U>
+    void sort_pairs(T keysBegin, T keysEnd, U valuesBegin) {
+        HybridSort::sort_pairs(keysBegin, keysEnd, valuesBegin,
+                               std::less<typename std::iterator_traits<T>::value_type>());
+    }
+
+    /**
+     * If the length of an array to be sorted is less than this
+     * constant, parallel_sort falls back to the sequential sort.
+     */
+    const int PARALLEL_SORT_THRESHOLD = 1048576;
+
+    template <typename T>
+    void parallel_sort(T begin, T end, int threads, std::true_type) {
+        parallelRadixSort(&(*begin), end - begin, threads);
+    }
+
+    template <typename T>
+    void parallel_sort(T begin, T end, int threads, std::false_type) {
+        HybridSort::sort(begin, end);
+    }
+
+    /**
+     * Sorts the range with multiple threads.
+     *
+     * @param begin the beginning of the range
+     * @param end the end of the range
+     * @param threads the maximum number of threads to use,
+     *                0 means std::thread::hardware_concurrency()
+     */
+    template <typename T>
+    void parallel_sort(T begin, T end, int threads = 0) {
+        if (threads <= 0) threads = std::thread::hardware_concurrency();
+        if (threads <= 1 || end - begin <= PARALLEL_SORT_THRESHOLD) {
+            HybridSort::sort(begin, end);
             return;
         }
-        radixSort(&(*begin), end - begin);
+        using V = typename std::iterator_traits<T>::value_type;
+        parallel_sort(begin, end, threads,
+                      std::integral_constant<bool, IsContiguousIterator<T>::value &&
+                                                       IsPrimitiveKey<V>::value>());
     }
 
-    template <typename T, typename Comp>
-    void sort(T begin, T end, Comp cmp) {
-        std::sort(begin, end, cmp);
-    }
+    /**
+     * Sorts arrays of T with a workspace which is kept and grown across
+     * calls, so that repeated sorts don't allocate scratch memory. The
+     * arrays are sorted the same way as by HybridSort::sort, and types
+     * without a radix key by HybridSort::sort itself.
+     */
+    template <typename T>
+    class Sorter {
+     public:
+        Sorter() : capacity(0) {}
+
+        /**
+         * Returns the size in bytes of the workspace needed to sort n elements,
+         * none if they are counted, sorted in place by American flag sort or
+         * too few to be merged.
+         *
+         * @param n the length of the array
+         */
+        static size_t scratchSize(Index n) {
+            if (!HasRadixKey<T>::value || n <= QUICKSORT_THRESHOLD || countsEveryArray<T>(n))
+                return 0;
+            const size_t size = sizeof(T) * n;
+            return n > radixSortThreshold<T>() && size > MAX_RADIX_SORT_BUFFER_SIZE ? 0 : size;
+        }
+
+        /**
+         * Grows the workspace, so that n elements can be sorted without
+         * allocation. The workspace is never value-initialized.
+         *
+         * @param n the length of the array
+         */
+        void reserve(Index n) {
+            Index length = static_cast<Index>(scratchSize(n) / sizeof(T));
+            if (length > capacity) {
+                work.reset(new T[length]);
+                capacity = length;
+            }
+        }
+
+        void sort(T *begin, T *end) {
+            const Index n = end - begin;
+            reserve(n);
+            sort(begin, n, std::integral_constant<bool, HasRadixKey<T>::value>());
+        }
+
+        void sort(typename std::vector<T>::iterator begin, typename std::vector<T>::iterator end) {
+            if (end - begin < 2) return;
+            sort(&(*begin), &(*begin) + (end - begin));
+        }
+
+     private:
+        void sort(T *a, Index n, std::true_type) {
+            if (narrowRangeSort(a, n, counts)) return;
+            if (n <= radixSortThreshold<T>()) {
+                dualPivotQuickSort<T, VectorizedQuickSort>(a, 0, n - 1, work.get(), 0, capacity,
+                                                           capacity);
+                return;
+            }
+            if (!mergeRuns(a, 0, n - 1, work.get(), 0, capacity, capacity, std::less<T>()))
+                hybridRadixSort(a, n, work.get());
+        }
+
+        void sort(T *a, Index n, std::false_type) {
+            HybridSort::sort(a, a + n);
+        }
+
+        std::unique_ptr<T[]> work;
+        Index capacity;
+        std::vector<Index> counts;
+    };
 }  // namespace HybridSort
 #endif
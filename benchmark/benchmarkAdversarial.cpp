@@ -0,0 +1,61 @@
+#include "benchmark.h"
+#include "../HybridSort.hpp"
+#include "../include/AntiQuickSort.hpp"
+#include <climits>
+#include <ctime>
+#include <iostream>
+#include <functional>
+#include <vector>
+#include <random>
+#include <string>
+
+// McIlroy's adversary attacking the sort with unlimited depth, quadratic without the guard
+static void unguarded(benchmark::State &state) {
+    const int n = state.range(0);
+    std::vector<int> a = HybridSort::antiQuickSort(n, INT_MAX);
+    std::vector<int> b;
+    for (auto s : state) {
+        b = a;
+        HybridSort::dualPivotQuickSort(b.data(), 0, n - 1, true, INT_MAX);
+    }
+    state.SetComplexityN(n);
+}
+
+static void guarded(benchmark::State &state) {
+    const int n = state.range(0);
+    std::vector<int> a = HybridSort::antiQuickSort(n, INT_MAX);
+    std::vector<int> b;
+    for (auto s : state) {
+        b = a;
+        HybridSort::dualPivotQuickSort(b.data(), 0, n - 1, true);
+    }
+    state.SetComplexityN(n);
+}
+
+// McIlroy's adversary attacking the guarded sort itself, heapsort included
+static void guardedWorstCase(benchmark::State &state) {
+    const int n = state.range(0);
+    std::vector<int> a = HybridSort::antiQuickSort(n, HybridSort::quickSortDepth(n));
+    std::vector<int> b;
+    for (auto s : state) {
+        b = a;
+        HybridSort::dualPivotQuickSort(b.data(), 0, n - 1, true);
+    }
+    state.SetComplexityN(n);
+}
+
+static void stdSort(benchmark::State &state) {
+    const int n = state.range(0);
+    std::vector<int> a = HybridSort::antiQuickSort(n, INT_MAX);
+    std::vector<int> b;
+    for (auto s : state) {
+        b = a;
+        std::sort(b.begin(), b.end());
+    }
+    state.SetComplexityN(n);
+}
+BENCHMARK(unguarded)->RangeMultiplier(2)->Range(1 << 10, 1 << 15)->Complexity();
+BENCHMARK(guarded)->RangeMultiplier(2)->Range(1 << 10, 1 << 15)->Complexity();
+BENCHMARK(stdSort)->RangeMultiplier(2)->Range(1 << 10, 1 << 15)->Complexity();
+BENCHMARK(guardedWorstCase)->RangeMultiplier(4)->Range(1 << 10, 1 << 20)->Complexity();
+BENCHMARK_MAIN();
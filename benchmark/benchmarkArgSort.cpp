@@ -0,0 +1,45 @@
+#include "benchmark.h"
+#include "../HybridSort.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <vector>
+#include <random>
+
+template <typename T>
+static std::vector<T> generate(long long n) {
+    auto gen = std::bind(std::uniform_int_distribution<long long>(0, 1LL << 40), std::mt19937());
+    std::vector<T> a(n);
+    for (long long i = 0; i < n; i++) a[i] = static_cast<T>(gen());
+    return a;
+}
+
+template <typename T>
+static void hybridArgsort(benchmark::State &state) {
+    const long long n = state.range(0);
+    std::vector<T> a = generate<T>(n);
+    std::vector<std::uint32_t> idx(n);
+    for (auto s : state) HybridSort::argsort(a.begin(), a.end(), idx.begin());
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename T>
+static void stdSortIndices(benchmark::State &state) {
+    const long long n = state.range(0);
+    std::vector<T> a = generate<T>(n);
+    std::vector<std::uint32_t> idx(n);
+    for (auto s : state) {
+        std::iota(idx.begin(), idx.end(), 0);
+        std::sort(idx.begin(), idx.end(),
+                  [&a](std::uint32_t i, std::uint32_t j) { return a[i] < a[j]; });
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(hybridArgsort, int)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_TEMPLATE(stdSortIndices, int)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_TEMPLATE(hybridArgsort, double)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_TEMPLATE(stdSortIndices, double)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_TEMPLATE(hybridArgsort, long long)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_TEMPLATE(stdSortIndices, long long)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_MAIN();
@@ -0,0 +1,48 @@
+#include "benchmark.h"
+#include "../HybridSort.hpp"
+#include <cstdlib>
+#include <functional>
+#include <vector>
+#include <random>
+
+static std::vector<int> generate(int n) {
+    auto gen = std::bind(std::uniform_int_distribution<int>(-1000000000, 1000000000),
+                         std::mt19937());
+    std::vector<int> a(n);
+    for (int i = 0; i < n; i++) a[i] = gen();
+    return a;
+}
+
+// Orders by absolute value, which no fast path recognizes
+struct AbsLess {
+    bool operator()(int x, int y) const { return std::abs(x) < std::abs(y); }
+};
+
+template <typename Compare>
+static void hybridSort(benchmark::State &state) {
+    const int n = state.range(0);
+    std::vector<int> a = generate(n);
+    std::vector<int> b;
+    for (auto s : state) {
+        b = a;
+        HybridSort::sort(b.begin(), b.end(), Compare());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename Compare>
+static void stdSort(benchmark::State &state) {
+    const int n = state.range(0);
+    std::vector<int> a = generate(n);
+    std::vector<int> b;
+    for (auto s : state) {
+        b = a;
+        std::sort(b.begin(), b.end(), Compare());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(hybridSort, std::greater<int>)->RangeMultiplier(8)->Range(1 << 10, 1 << 24);
+BENCHMARK_TEMPLATE(stdSort, std::greater<int>)->RangeMultiplier(8)->Range(1 << 10, 1 << 24);
+BENCHMARK_TEMPLATE(hybridSort, AbsLess)->RangeMultiplier(8)->Range(1 << 10, 1 << 24);
+BENCHMARK_TEMPLATE(stdSort, AbsLess)->RangeMultiplier(8)->Range(1 << 10, 1 << 24);
+BENCHMARK_MAIN();
@@ -0,0 +1,71 @@
+#include "benchmark.h"
+#include "../HybridSort.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include <random>
+
+/*
+ * Edges between vertices in [0, n), as in an edge list of a graph.
+ */
+static std::vector<std::pair<uint32_t, uint32_t> > edges(long long n) {
+    auto gen = std::bind(std::uniform_int_distribution<uint32_t>(0, n - 1), std::mt19937());
+    std::vector<std::pair<uint32_t, uint32_t> > a(n);
+    for (long long i = 0; i < n; i++) a[i] = std::make_pair(gen(), gen());
+    return a;
+}
+
+static std::vector<std::tuple<int, int, int> > triples(long long n) {
+    auto gen = std::bind(std::uniform_int_distribution<int>(), std::mt19937());
+    std::vector<std::tuple<int, int, int> > a(n);
+    for (long long i = 0; i < n; i++) a[i] = std::make_tuple(gen(), gen(), gen());
+    return a;
+}
+
+static void hybridSortEdges(benchmark::State &state) {
+    const long long n = state.range(0);
+    std::vector<std::pair<uint32_t, uint32_t> > a = edges(n), b;
+    for (auto s : state) {
+        b = a;
+        HybridSort::sort(b.begin(), b.end());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void stdSortEdges(benchmark::State &state) {
+    const long long n = state.range(0);
+    std::vector<std::pair<uint32_t, uint32_t> > a = edges(n), b;
+    for (auto s : state) {
+        b = a;
+        std::sort(b.begin(), b.end());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void hybridSortTriples(benchmark::State &state) {
+    const long long n = state.range(0);
+    std::vector<std::tuple<int, int, int> > a = triples(n), b;
+    for (auto s : state) {
+        b = a;
+        HybridSort::sort(b.begin(), b.end());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void stdSortTriples(benchmark::State &state) {
+    const long long n = state.range(0);
+    std::vector<std::tuple<int, int, int> > a = triples(n), b;
+    for (auto s : state) {
+        b = a;
+        std::sort(b.begin(), b.end());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(hybridSortEdges)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK(stdSortEdges)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK(hybridSortTriples)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK(stdSortTriples)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_MAIN();
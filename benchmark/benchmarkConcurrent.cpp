@@ -0,0 +1,44 @@
+#include "benchmark.h"
+#include "../HybridSort.hpp"
+#include <ctime>
+#include <iostream>
+#include <functional>
+#include <vector>
+#include <random>
+#include <string>
+
+// Every benchmark thread sorts its own arrays, which measures the throughput
+// of independent sorts running at the same time.
+
+static void hybridSort(benchmark::State &state) {
+    const int n = state.range(0);
+    auto gen = std::bind(std::uniform_int_distribution<int>(), std::mt19937());
+    std::vector<int> a(n);
+    for (int i = 0; i < n; i++) a[i] = gen();
+    std::vector<int> b;
+    for (auto s : state) {
+        b = a;
+        HybridSort::sort(b.begin(), b.end());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void stdSort(benchmark::State &state) {
+    const int n = state.range(0);
+    auto gen = std::bind(std::uniform_int_distribution<int>(), std::mt19937());
+    std::vector<int> a(n);
+    for (int i = 0; i < n; i++) a[i] = gen();
+    std::vector<int> b;
+    for (auto s : state) {
+        b = a;
+        std::sort(b.begin(), b.end());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(hybridSort)
+    ->RangeMultiplier(16)
+    ->Range(1 << 10, 1 << 22)
+    ->ThreadRange(1, 32)
+    ->UseRealTime();
+BENCHMARK(stdSort)->RangeMultiplier(16)->Range(1 << 10, 1 << 22)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK_MAIN();
@@ -0,0 +1,49 @@
+#include "benchmark.h"
+#include "../HybridSort.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include <random>
+
+/*
+ * Keys of RANGE distinct values, as status codes or 8-bit and 16-bit keys.
+ */
+template <typename T, long long RANGE>
+static std::vector<T> generate(long long n) {
+    auto gen = std::bind(std::uniform_int_distribution<long long>(0, RANGE - 1), std::mt19937());
+    std::vector<T> a(n);
+    for (long long i = 0; i < n; i++) a[i] = static_cast<T>(gen());
+    return a;
+}
+
+template <typename T, long long RANGE>
+static void hybridSortRange(benchmark::State &state) {
+    const long long n = state.range(0);
+    std::vector<T> a = generate<T, RANGE>(n), b;
+    for (auto s : state) {
+        b = a;
+        HybridSort::sort(b.begin(), b.end());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename T, long long RANGE>
+static void stdSortRange(benchmark::State &state) {
+    const long long n = state.range(0);
+    std::vector<T> a = generate<T, RANGE>(n), b;
+    for (auto s : state) {
+        b = a;
+        std::sort(b.begin(), b.end());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(hybridSortRange, uint8_t, 256)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_TEMPLATE(stdSortRange, uint8_t, 256)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_TEMPLATE(hybridSortRange, uint16_t, 65536)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_TEMPLATE(stdSortRange, uint16_t, 65536)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_TEMPLATE(hybridSortRange, int, 1000)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_TEMPLATE(stdSortRange, int, 1000)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_TEMPLATE(hybridSortRange, long long, 60000)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_TEMPLATE(stdSortRange, long long, 60000)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_MAIN();
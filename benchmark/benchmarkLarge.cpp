@@ -0,0 +1,81 @@
+#include "benchmark.h"
+#include "../HybridSort.hpp"
+#include <functional>
+#include <vector>
+#include <random>
+
+// Arrays past 2^31 elements, which need a machine with tens of GiB of memory
+template <typename T>
+static std::vector<T> generate(long long n) {
+    auto gen = std::bind(std::uniform_int_distribution<long long>(), std::mt19937_64());
+    std::vector<T> a(n);
+    for (long long i = 0; i < n; i++) a[i] = static_cast<T>(gen());
+    return a;
+}
+
+template <typename T>
+static void hybridSort(benchmark::State &state) {
+    const long long n = state.range(0);
+    std::vector<T> a = generate<T>(n);
+    std::vector<T> b(n);
+    for (auto s : state) {
+        state.PauseTiming();
+        b = a;
+        state.ResumeTiming();
+        HybridSort::sort(b.begin(), b.end());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename T>
+static void parallelSort(benchmark::State &state) {
+    const long long n = state.range(0);
+    std::vector<T> a = generate<T>(n);
+    std::vector<T> b(n);
+    for (auto s : state) {
+        state.PauseTiming();
+        b = a;
+        state.ResumeTiming();
+        HybridSort::parallel_sort(b.begin(), b.end());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename T>
+static void stdSort(benchmark::State &state) {
+    const long long n = state.range(0);
+    std::vector<T> a = generate<T>(n);
+    std::vector<T> b(n);
+    for (auto s : state) {
+        state.PauseTiming();
+        b = a;
+        state.ResumeTiming();
+        std::sort(b.begin(), b.end());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(hybridSort, int)
+    ->Arg(1 << 24)
+    ->Arg(1LL << 31)
+    ->Arg(3LL << 30)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(parallelSort, int)
+    ->Arg(1 << 24)
+    ->Arg(1LL << 31)
+    ->Arg(3LL << 30)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(stdSort, int)
+    ->Arg(1 << 24)
+    ->Arg(1LL << 31)
+    ->Arg(3LL << 30)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(hybridSort, unsigned char)
+    ->Arg(1 << 24)
+    ->Arg(1LL << 32)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(stdSort, unsigned char)
+    ->Arg(1 << 24)
+    ->Arg(1LL << 32)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_MAIN();
@@ -0,0 +1,63 @@
+#include "benchmark.h"
+#include "../HybridSort.hpp"
+#include <ctime>
+#include <iostream>
+#include <functional>
+#include <vector>
+#include <random>
+#include <string>
+
+static void parallelSort(benchmark::State &state) {
+    const int n = state.range(0);
+    const int threads = state.range(1);
+    auto gen = std::bind(std::uniform_int_distribution<int>(), std::mt19937());
+    std::vector<int> a(n);
+    for (int i = 0; i < n; i++) a[i] = gen();
+    std::vector<int> b;
+    for (auto s : state) {
+        b = a;
+        HybridSort::parallel_sort(b.begin(), b.end(), threads);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void hybridSort(benchmark::State &state) {
+    const int n = state.range(0);
+    auto gen = std::bind(std::uniform_int_distribution<int>(), std::mt19937());
+    std::vector<int> a(n);
+    for (int i = 0; i < n; i++) a[i] = gen();
+    std::vector<int> b;
+    for (auto s : state) {
+        b = a;
+        HybridSort::sort(b.begin(), b.end());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void parallelQuickSort(benchmark::State &state) {
+    const int n = state.range(0);
+    const int threads = state.range(1);
+    auto gen = std::bind(std::uniform_real_distribution<double>(), std::mt19937());
+    std::vector<double> a(n);
+    for (int i = 0; i < n; i++) a[i] = gen();
+    std::vector<double> b;
+    for (auto s : state) {
+        b = a;
+        HybridSort::parallelDualPivotQuickSort(b.data(), n, threads);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+BENCHMARK(parallelSort)
+    ->RangeMultiplier(2)
+    ->Ranges({{1 << 20, 1 << 26}, {1, 32}})
+    ->Args({100000000, 1})
+    ->Args({100000000, 8})
+    ->Args({100000000, 32})
+    ->UseRealTime();
+BENCHMARK(parallelQuickSort)
+    ->RangeMultiplier(2)
+    ->Ranges({{1 << 20, 1 << 26}, {1, 32}})
+    ->UseRealTime();
+BENCHMARK(hybridSort)->RangeMultiplier(2)->Range(1 << 20, 1 << 26)->Arg(100000000)->UseRealTime();
+BENCHMARK_MAIN();
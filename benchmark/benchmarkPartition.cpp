@@ -0,0 +1,39 @@
+#include "benchmark.h"
+#include "../HybridSort.hpp"
+#include <ctime>
+#include <iostream>
+#include <functional>
+#include <vector>
+#include <random>
+#include <string>
+
+// state.range(1) is the number of random bits of each key, 0 for full entropy
+static std::vector<double> generate(int n, int bits) {
+    auto gen = std::bind(std::uniform_int_distribution<long long>(), std::mt19937_64());
+    const long long mask = bits ? (1LL << bits) - 1 : -1LL;
+    std::vector<double> a(n);
+    for (int i = 0; i < n; i++) a[i] = gen() & mask;
+    return a;
+}
+
+template <typename Kernel>
+static void partitionKernel(benchmark::State &state) {
+    const int n = state.range(0);
+    std::vector<double> a = generate(n, state.range(1));
+    std::vector<double> b;
+    for (auto s : state) {
+        b = a;
+        HybridSort::dualPivotQuickSort<double, Kernel>(b.data(), 0, n - 1, true);
+    }
+}
+BENCHMARK_TEMPLATE(partitionKernel, HybridSort::BranchPartition)
+    ->RangeMultiplier(16)
+    ->Ranges({{1 << 10, 1 << 22}, {0, 0}})
+    ->Args({1 << 20, 4})
+    ->Args({1 << 20, 12});
+BENCHMARK_TEMPLATE(partitionKernel, HybridSort::BlockPartition)
+    ->RangeMultiplier(16)
+    ->Ranges({{1 << 10, 1 << 22}, {0, 0}})
+    ->Args({1 << 20, 4})
+    ->Args({1 << 20, 12});
+BENCHMARK_MAIN();
@@ -0,0 +1,38 @@
+#include "benchmark.h"
+#include "../HybridSort.hpp"
+#include <ctime>
+#include <iostream>
+#include <functional>
+#include <vector>
+#include <random>
+#include <string>
+
+template <int BITS>
+static void radixSortDigits(benchmark::State &state) {
+    const int n = state.range(0);
+    auto gen = std::bind(std::uniform_int_distribution<int>(), std::mt19937());
+    std::vector<int> a(n), work(n);
+    for (int i = 0; i < n; i++) a[i] = gen();
+    std::vector<int> b;
+    for (auto s : state) {
+        b = a;
+        HybridSort::lsdRadixSortDigits<BITS>(b.data(), n, work.data());
+    }
+}
+
+static void adaptiveRadixSort(benchmark::State &state) {
+    const int n = state.range(0);
+    auto gen = std::bind(std::uniform_int_distribution<int>(), std::mt19937());
+    std::vector<int> a(n), work(n);
+    for (int i = 0; i < n; i++) a[i] = gen();
+    std::vector<int> b;
+    for (auto s : state) {
+        b = a;
+        HybridSort::adaptiveRadixSort(b.data(), n, work.data());
+    }
+}
+BENCHMARK_TEMPLATE(radixSortDigits, 8)->RangeMultiplier(2)->Range(1 << 20, 1 << 28);
+BENCHMARK_TEMPLATE(radixSortDigits, 11)->RangeMultiplier(2)->Range(1 << 20, 1 << 28);
+BENCHMARK_TEMPLATE(radixSortDigits, 16)->RangeMultiplier(2)->Range(1 << 20, 1 << 28);
+BENCHMARK(adaptiveRadixSort)->RangeMultiplier(2)->Range(1 << 20, 1 << 28);
+BENCHMARK_MAIN();
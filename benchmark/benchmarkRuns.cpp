@@ -0,0 +1,71 @@
+#include "benchmark.h"
+#include "../HybridSort.hpp"
+#include <algorithm>
+#include <functional>
+#include <vector>
+#include <random>
+
+/*
+ * Arrays of n keys made of k ascending runs. The runs hold random keys, or,
+ * like sorted batches of timestamps, keys that increase with their index
+ * with a jitter of 1/32 of a run, so that adjacent runs hardly overlap.
+ */
+static std::vector<int> generate(long long n, long long k, bool batches) {
+    auto gen = std::bind(std::uniform_int_distribution<int>(), std::mt19937());
+    const long long jitter = 16 * std::max(1LL, n / k / 32);
+    std::vector<int> a(n);
+    for (long long i = 0; i < n; i++) a[i] = batches ? 16 * i + gen() % jitter : gen();
+    for (long long i = 0; i < k; i++) std::sort(a.begin() + n * i / k, a.begin() + n * (i + 1) / k);
+    return a;
+}
+
+template <bool BATCHES>
+static void hybridSort(benchmark::State &state) {
+    const long long n = state.range(0), k = state.range(1);
+    std::vector<int> a = generate(n, k, BATCHES);
+    std::vector<int> b;
+    for (auto s : state) {
+        b = a;
+        HybridSort::sort(b.begin(), b.end());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <bool BATCHES>
+static void stdSort(benchmark::State &state) {
+    const long long n = state.range(0), k = state.range(1);
+    std::vector<int> a = generate(n, k, BATCHES);
+    std::vector<int> b;
+    for (auto s : state) {
+        b = a;
+        std::sort(b.begin(), b.end());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <bool BATCHES>
+static void stdStableSort(benchmark::State &state) {
+    const long long n = state.range(0), k = state.range(1);
+    std::vector<int> a = generate(n, k, BATCHES);
+    std::vector<int> b;
+    for (auto s : state) {
+        b = a;
+        std::stable_sort(b.begin(), b.end());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void runCounts(benchmark::internal::Benchmark *b) {
+    for (long long n : {1000000LL, 10000000LL}) {
+        for (long long k : {2, 3, 10, 30, 100, 300, 1000, 3000, 10000, 30000, 100000}) {
+            b->Args({n, k});
+        }
+    }
+}
+BENCHMARK_TEMPLATE(hybridSort, false)->Apply(runCounts);
+BENCHMARK_TEMPLATE(stdSort, false)->Apply(runCounts);
+BENCHMARK_TEMPLATE(stdStableSort, false)->Apply(runCounts);
+BENCHMARK_TEMPLATE(hybridSort, true)->Apply(runCounts);
+BENCHMARK_TEMPLATE(stdSort, true)->Apply(runCounts);
+BENCHMARK_TEMPLATE(stdStableSort, true)->Apply(runCounts);
+BENCHMARK_MAIN();
@@ -0,0 +1,74 @@
+#include "benchmark.h"
+#include "../HybridSort.hpp"
+#include <algorithm>
+#include <functional>
+#include <vector>
+#include <random>
+
+const int K = 100;
+
+template <typename T>
+static std::vector<T> generate(long long n) {
+    auto gen = std::bind(std::uniform_int_distribution<long long>(0, 1LL << 40), std::mt19937());
+    std::vector<T> a(n);
+    for (long long i = 0; i < n; i++) a[i] = static_cast<T>(gen());
+    return a;
+}
+
+template <typename T>
+static void hybridNthElement(benchmark::State &state) {
+    const long long n = state.range(0);
+    std::vector<T> a = generate<T>(n);
+    std::vector<T> b;
+    for (auto s : state) {
+        b = a;
+        HybridSort::nth_element(b.begin(), b.begin() + n / 2, b.end());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename T>
+static void stdNthElement(benchmark::State &state) {
+    const long long n = state.range(0);
+    std::vector<T> a = generate<T>(n);
+    std::vector<T> b;
+    for (auto s : state) {
+        b = a;
+        std::nth_element(b.begin(), b.begin() + n / 2, b.end());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename T>
+static void hybridTopK(benchmark::State &state) {
+    const long long n = state.range(0);
+    std::vector<T> a = generate<T>(n);
+    std::vector<T> b;
+    for (auto s : state) {
+        b = a;
+        HybridSort::top_k(b.begin(), b.end(), std::min<long long>(n, K));
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename T>
+static void stdPartialSort(benchmark::State &state) {
+    const long long n = state.range(0);
+    std::vector<T> a = generate<T>(n);
+    std::vector<T> b;
+    for (auto s : state) {
+        b = a;
+        std::partial_sort(b.begin(), b.begin() + std::min<long long>(n, K), b.end(),
+                          std::greater<T>());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(hybridNthElement, int)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_TEMPLATE(stdNthElement, int)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_TEMPLATE(hybridNthElement, double)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_TEMPLATE(stdNthElement, double)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_TEMPLATE(hybridTopK, int)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_TEMPLATE(stdPartialSort, int)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_TEMPLATE(hybridTopK, double)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_TEMPLATE(stdPartialSort, double)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_MAIN();
@@ -0,0 +1,63 @@
+#include "benchmark.h"
+#include "../HybridSort.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include <random>
+
+/*
+ * Records of SIZE bytes with a 32-bit key.
+ */
+template <int SIZE>
+struct Record {
+    std::uint32_t key;
+    char payload[SIZE - sizeof(std::uint32_t)];
+};
+
+template <int SIZE>
+static std::vector<Record<SIZE> > generate(long long n) {
+    auto gen = std::bind(std::uniform_int_distribution<std::uint32_t>(), std::mt19937());
+    std::vector<Record<SIZE> > a(n);
+    for (long long i = 0; i < n; i++) {
+        a[i].key = gen();
+        a[i].payload[0] = static_cast<char>(i);
+    }
+    return a;
+}
+
+template <int SIZE>
+static void hybridSortByKey(benchmark::State &state) {
+    const long long n = state.range(0);
+    std::vector<Record<SIZE> > a = generate<SIZE>(n);
+    std::vector<Record<SIZE> > b;
+    for (auto s : state) {
+        b = a;
+        HybridSort::sort_by_key(b.begin(), b.end(), [](const Record<SIZE> &x) { return x.key; });
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <int SIZE>
+static void stdSortByKey(benchmark::State &state) {
+    const long long n = state.range(0);
+    std::vector<Record<SIZE> > a = generate<SIZE>(n);
+    std::vector<Record<SIZE> > b;
+    for (auto s : state) {
+        b = a;
+        std::sort(b.begin(), b.end(),
+                  [](const Record<SIZE> &x, const Record<SIZE> &y) { return x.key < y.key; });
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(hybridSortByKey, 8)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_TEMPLATE(stdSortByKey, 8)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_TEMPLATE(hybridSortByKey, 16)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_TEMPLATE(stdSortByKey, 16)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_TEMPLATE(hybridSortByKey, 32)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_TEMPLATE(stdSortByKey, 32)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_TEMPLATE(hybridSortByKey, 64)->RangeMultiplier(8)->Range(8, 1 << 21);
+BENCHMARK_TEMPLATE(stdSortByKey, 64)->RangeMultiplier(8)->Range(8, 1 << 21);
+BENCHMARK_TEMPLATE(hybridSortByKey, 128)->RangeMultiplier(8)->Range(8, 1 << 21);
+BENCHMARK_TEMPLATE(stdSortByKey, 128)->RangeMultiplier(8)->Range(8, 1 << 21);
+BENCHMARK_MAIN();
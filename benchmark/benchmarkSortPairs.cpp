@@ -0,0 +1,62 @@
+#include "benchmark.h"
+#include "../HybridSort.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+#include <random>
+
+template <typename T>
+static std::vector<T> generate(long long n) {
+    auto gen = std::bind(std::uniform_int_distribution<T>(), std::mt19937_64());
+    std::vector<T> a(n);
+    for (long long i = 0; i < n; i++) a[i] = gen();
+    return a;
+}
+
+template <typename K, typename V>
+static void hybridSortPairs(benchmark::State &state) {
+    const long long n = state.range(0);
+    std::vector<K> a = generate<K>(n);
+    std::vector<V> v = generate<V>(n);
+    std::vector<K> keys;
+    std::vector<V> values;
+    for (auto s : state) {
+        keys = a;
+        values = v;
+        HybridSort::sort_pairs(keys.begin(), keys.end(), values.begin());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+/*
+ * Zips the keys and values into pairs, sorts them by key and unzips them.
+ */
+template <typename K, typename V>
+static void stdSortPairs(benchmark::State &state) {
+    const long long n = state.range(0);
+    std::vector<K> a = generate<K>(n);
+    std::vector<V> v = generate<V>(n);
+    std::vector<K> keys;
+    std::vector<V> values;
+    std::vector<std::pair<K, V> > p(n);
+    for (auto s : state) {
+        keys = a;
+        values = v;
+        for (long long i = 0; i < n; i++) p[i] = std::make_pair(keys[i], values[i]);
+        std::sort(p.begin(), p.end(), [](const std::pair<K, V> &x, const std::pair<K, V> &y) {
+            return x.first < y.first;
+        });
+        for (long long i = 0; i < n; i++) {
+            keys[i] = p[i].first;
+            values[i] = p[i].second;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(hybridSortPairs, uint32_t, uint32_t)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_TEMPLATE(stdSortPairs, uint32_t, uint32_t)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_TEMPLATE(hybridSortPairs, uint64_t, uint64_t)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_TEMPLATE(stdSortPairs, uint64_t, uint64_t)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_MAIN();
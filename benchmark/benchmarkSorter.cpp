@@ -0,0 +1,43 @@
+#include "benchmark.h"
+#include "../HybridSort.hpp"
+#include <ctime>
+#include <iostream>
+#include <functional>
+#include <vector>
+#include <random>
+#include <string>
+
+// Arrays made of eight sorted runs, which take the merge path of dual pivot quick sort
+static std::vector<int> generate(int n) {
+    auto gen = std::bind(std::uniform_int_distribution<int>(), std::mt19937());
+    std::vector<int> a(n);
+    for (int i = 0; i < n; i++) a[i] = gen();
+    for (int i = 0; i < n; i += n / 8 + 1)
+        std::sort(a.begin() + i, a.begin() + std::min(n, i + n / 8 + 1));
+    return a;
+}
+
+static void hybridSort(benchmark::State &state) {
+    const int n = state.range(0);
+    std::vector<int> a = generate(n);
+    std::vector<int> b;
+    for (auto s : state) {
+        b = a;
+        HybridSort::sort(b.begin(), b.end());
+    }
+}
+
+static void sorter(benchmark::State &state) {
+    const int n = state.range(0);
+    std::vector<int> a = generate(n);
+    std::vector<int> b;
+    HybridSort::Sorter<int> sorter;
+    sorter.reserve(n);
+    for (auto s : state) {
+        b = a;
+        sorter.sort(b.begin(), b.end());
+    }
+}
+BENCHMARK(hybridSort)->RangeMultiplier(4)->Range(1 << 10, 1 << 22);
+BENCHMARK(sorter)->RangeMultiplier(4)->Range(1 << 10, 1 << 22);
+BENCHMARK_MAIN();
@@ -0,0 +1,95 @@
+#include "benchmark.h"
+#include "../HybridSort.hpp"
+#include <algorithm>
+#include <functional>
+#include <vector>
+#include <random>
+
+struct Event {
+    long long time;
+    int source;
+    int payload;
+};
+
+struct EventLess {
+    bool operator()(const Event &x, const Event &y) const { return x.time < y.time; }
+};
+
+/*
+ * Events with random times, or events of 100 sources whose sorted streams
+ * are concatenated in batches of 1000, like a pipeline collecting them.
+ */
+static std::vector<Event> events(long long n, bool batches) {
+    auto gen = std::bind(std::uniform_int_distribution<long long>(0, 1LL << 40), std::mt19937());
+    std::vector<Event> a(n);
+    for (long long i = 0; i < n; i++) {
+        a[i].time = batches ? i * 1000 + gen() % 100000 : gen();
+        a[i].source = static_cast<int>(i % 100);
+        a[i].payload = static_cast<int>(i);
+    }
+    if (batches) {
+        for (long long i = 0; i < n; i += 1000)
+            std::sort(a.begin() + i, a.begin() + std::min(n, i + 1000), EventLess());
+    }
+    return a;
+}
+
+template <bool BATCHES>
+static void hybridStableSortEvents(benchmark::State &state) {
+    const long long n = state.range(0);
+    std::vector<Event> a = events(n, BATCHES);
+    std::vector<Event> b;
+    for (auto s : state) {
+        b = a;
+        HybridSort::stable_sort(b.begin(), b.end(), EventLess());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <bool BATCHES>
+static void stdStableSortEvents(benchmark::State &state) {
+    const long long n = state.range(0);
+    std::vector<Event> a = events(n, BATCHES);
+    std::vector<Event> b;
+    for (auto s : state) {
+        b = a;
+        std::stable_sort(b.begin(), b.end(), EventLess());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+static std::vector<double> doubles(long long n) {
+    auto gen = std::bind(std::uniform_real_distribution<double>(), std::mt19937());
+    std::vector<double> a(n);
+    for (long long i = 0; i < n; i++) a[i] = gen();
+    return a;
+}
+
+static void hybridStableSortDouble(benchmark::State &state) {
+    const long long n = state.range(0);
+    std::vector<double> a = doubles(n);
+    std::vector<double> b;
+    for (auto s : state) {
+        b = a;
+        HybridSort::stable_sort(b.begin(), b.end());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void stdStableSortDouble(benchmark::State &state) {
+    const long long n = state.range(0);
+    std::vector<double> a = doubles(n);
+    std::vector<double> b;
+    for (auto s : state) {
+        b = a;
+        std::stable_sort(b.begin(), b.end());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(hybridStableSortEvents, false)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_TEMPLATE(stdStableSortEvents, false)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_TEMPLATE(hybridStableSortEvents, true)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_TEMPLATE(stdStableSortEvents, true)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK(hybridStableSortDouble)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK(stdStableSortDouble)->RangeMultiplier(8)->Range(8, 1 << 24);
+BENCHMARK_MAIN();
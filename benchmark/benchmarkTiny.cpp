@@ -0,0 +1,41 @@
+#include "benchmark.h"
+#include "../HybridSort.hpp"
+#include <ctime>
+#include <iostream>
+#include <functional>
+#include <vector>
+#include <random>
+#include <string>
+
+// Many short arrays of state.range(0) elements each, sorted one by one
+static const int TOTAL = 1 << 16;
+
+static std::vector<int> generate() {
+    auto gen = std::bind(std::uniform_int_distribution<int>(), std::mt19937());
+    std::vector<int> a(TOTAL);
+    for (int i = 0; i < TOTAL; i++) a[i] = gen();
+    return a;
+}
+
+static void hybridSort(benchmark::State &state) {
+    const int n = state.range(0);
+    std::vector<int> a = generate();
+    std::vector<int> b;
+    for (auto s : state) {
+        b = a;
+        for (int i = 0; i + n <= TOTAL; i += n) HybridSort::sort(b.begin() + i, b.begin() + i + n);
+    }
+}
+
+static void stdSort(benchmark::State &state) {
+    const int n = state.range(0);
+    std::vector<int> a = generate();
+    std::vector<int> b;
+    for (auto s : state) {
+        b = a;
+        for (int i = 0; i + n <= TOTAL; i += n) std::sort(b.begin() + i, b.begin() + i + n);
+    }
+}
+BENCHMARK(hybridSort)->RangeMultiplier(2)->Range(4, 64);
+BENCHMARK(stdSort)->RangeMultiplier(2)->Range(4, 64);
+BENCHMARK_MAIN();
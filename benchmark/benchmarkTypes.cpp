@@ -0,0 +1,73 @@
+#include "benchmark.h"
+#include "../HybridSort.hpp"
+#include <array>
+#include <functional>
+#include <vector>
+#include <random>
+
+// Key types which used to fall through to std::sort
+enum class Priority : int {};
+
+template <typename T>
+static std::vector<T> generate(int n) {
+    auto gen = std::bind(std::uniform_int_distribution<long long>(LLONG_MIN), std::mt19937_64());
+    std::vector<T> a(n);
+    for (int i = 0; i < n; i++) a[i] = static_cast<T>(gen());
+    return a;
+}
+
+template <typename T>
+static void hybridSort(benchmark::State &state) {
+    const int n = state.range(0);
+    std::vector<T> a = generate<T>(n);
+    std::vector<T> b;
+    for (auto s : state) {
+        b = a;
+        HybridSort::sort(b.begin(), b.end());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename T>
+static void stdSort(benchmark::State &state) {
+    const int n = state.range(0);
+    std::vector<T> a = generate<T>(n);
+    std::vector<T> b;
+    for (auto s : state) {
+        b = a;
+        std::sort(b.begin(), b.end());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+// A std::array range, whose iterators are not std::vector iterators
+static void hybridSortArray(benchmark::State &state) {
+    static std::array<long, 1 << 16> a, b;
+    std::vector<long> v = generate<long>(a.size());
+    std::copy(v.begin(), v.end(), a.begin());
+    for (auto s : state) {
+        b = a;
+        HybridSort::sort(b.begin(), b.end());
+    }
+}
+
+static void stdSortArray(benchmark::State &state) {
+    static std::array<long, 1 << 16> a, b;
+    std::vector<long> v = generate<long>(a.size());
+    std::copy(v.begin(), v.end(), a.begin());
+    for (auto s : state) {
+        b = a;
+        std::sort(b.begin(), b.end());
+    }
+}
+BENCHMARK_TEMPLATE(hybridSort, long)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(stdSort, long)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(hybridSort, wchar_t)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(stdSort, wchar_t)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(hybridSort, signed char)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(stdSort, signed char)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(hybridSort, Priority)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(stdSort, Priority)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK(hybridSortArray);
+BENCHMARK(stdSortArray);
+BENCHMARK_MAIN();
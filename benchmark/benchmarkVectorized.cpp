@@ -0,0 +1,45 @@
+#include "benchmark.h"
+#include "../HybridSort.hpp"
+#include <ctime>
+#include <iostream>
+#include <functional>
+#include <vector>
+#include <random>
+#include <string>
+
+template <typename T>
+static std::vector<T> generate(int n) {
+    auto gen = std::bind(std::uniform_int_distribution<long long>(), std::mt19937_64());
+    std::vector<T> a(n);
+    for (int i = 0; i < n; i++) a[i] = static_cast<T>(gen());
+    return a;
+}
+
+// state.range(1) is the instruction set, SIMD_SCALAR runs dual pivot quick sort
+template <typename T>
+static void vectorizedQuickSort(benchmark::State &state) {
+    const int n = state.range(0), level = state.range(1);
+    if (level > HybridSort::simdLevel()) {
+        state.SkipWithError("instruction set not supported");
+        return;
+    }
+    std::vector<T> a = generate<T>(n);
+    std::vector<T> b;
+    for (auto s : state) {
+        b = a;
+        HybridSort::vectorizedQuickSort(b.data(), 0, n - 1, level);
+    }
+}
+BENCHMARK_TEMPLATE(vectorizedQuickSort, int)
+    ->RangeMultiplier(8)
+    ->Ranges({{1 << 10, 1 << 21}, {HybridSort::SIMD_SCALAR, HybridSort::SIMD_AVX512}});
+BENCHMARK_TEMPLATE(vectorizedQuickSort, float)
+    ->RangeMultiplier(8)
+    ->Ranges({{1 << 10, 1 << 21}, {HybridSort::SIMD_SCALAR, HybridSort::SIMD_AVX512}});
+BENCHMARK_TEMPLATE(vectorizedQuickSort, double)
+    ->RangeMultiplier(8)
+    ->Ranges({{1 << 10, 1 << 21}, {HybridSort::SIMD_SCALAR, HybridSort::SIMD_AVX512}});
+BENCHMARK_TEMPLATE(vectorizedQuickSort, long long)
+    ->RangeMultiplier(8)
+    ->Ranges({{1 << 10, 1 << 21}, {HybridSort::SIMD_SCALAR, HybridSort::SIMD_AVX512}});
+BENCHMARK_MAIN();
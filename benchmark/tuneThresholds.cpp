@@ -0,0 +1,237 @@
+#include "benchmark.h"
+#include "../HybridSort.hpp"
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+/*
+ * Measures the crossover points of the sorting methods on this machine and
+ * writes them as a profile, which HybridSort loads from the file named by
+ * the HYBRID_SORT_PROFILE environment variable, and as a header, which can
+ * be compiled in by defining HYBRID_SORT_PROFILE_HEADER.
+ *
+ * Usage: tuneThresholds [benchmark options] [profile path] [header path]
+ *
+ * A threshold is only written if all its runs are measured, so a subset of
+ * them can be tuned with --benchmark_filter.
+ */
+
+// Short arrays are sorted in batches of at least this many elements
+static const long long BATCH = 1 << 16;
+
+// Every benchmark is repeated, and the fastest repetition counts
+static const int REPETITIONS = 3;
+
+// Keeps the least CPU time of the repetitions of every run besides printing it
+class Collector : public benchmark::ConsoleReporter {
+ public:
+    void ReportRuns(const std::vector<Run> &runs) override {
+        for (const Run &run : runs) {
+            if (run.run_type != Run::RT_Iteration) continue;
+            const std::string name = run.benchmark_name();
+            const std::string key = name.substr(0, name.find("/repeats:"));
+            auto it = times.find(key);
+            if (it == times.end()) {
+                times[key] = run.GetAdjustedCPUTime();
+            } else {
+                it->second = std::min(it->second, run.GetAdjustedCPUTime());
+            }
+        }
+        benchmark::ConsoleReporter::ReportRuns(runs);
+    }
+
+    std::map<std::string, double> times;
+};
+
+static std::string name(const std::string &method, const std::string &group, long long n) {
+    return method + "/" + group + "/" + std::to_string(n);
+}
+
+// Registers a benchmark which sorts copies of generate(n, i) by sort(a, n)
+template <typename T, typename Generate, typename Sort>
+static void add(const std::string &name, long long n, Generate generate, Sort sort) {
+    benchmark::RegisterBenchmark(name.c_str(), [=](benchmark::State &state) {
+        const long long count = std::max(1LL, BATCH / n);
+        std::vector<T> a, b;
+        for (long long i = 0; i < count; i++) {
+            std::vector<T> part = generate(n, i);
+            a.insert(a.end(), part.begin(), part.end());
+        }
+        for (auto s : state) {
+            b = a;
+            for (long long i = 0; i < count; i++) sort(b.data() + i * n, n);
+        }
+        state.SetItemsProcessed(state.iterations() * count * n);
+    })->Repetitions(REPETITIONS);
+}
+
+template <typename T>
+static std::vector<T> randomKeys(long long n, long long seed) {
+    auto gen = std::bind(std::uniform_int_distribution<long long>(), std::mt19937_64(seed));
+    std::vector<T> a(n);
+    for (long long i = 0; i < n; i++) a[i] = static_cast<T>(gen());
+    return a;
+}
+
+// Random keys made of k sorted runs of about the same length
+static std::vector<int> runs(long long n, long long k, long long seed) {
+    std::vector<int> a = randomKeys<int>(n, seed);
+    for (long long i = 0; i < k; i++) std::sort(a.begin() + n * i / k, a.begin() + n * (i + 1) / k);
+    return a;
+}
+
+/**
+ * Returns the largest length at which the first method is faster than the
+ * second one, which wins at all the larger lengths, lengths.front() - 1 if
+ * the second one always wins, or -1 if some run is missing.
+ */
+static long long crossover(const std::map<std::string, double> &times, const std::string &first,
+                           const std::string &second, const std::string &group,
+                           const std::vector<long long> &lengths) {
+    for (long long n : lengths) {
+        if (!times.count(name(first, group, n)) || !times.count(name(second, group, n))) return -1;
+    }
+    for (size_t i = lengths.size(); i-- > 0;) {
+        if (times.at(name(first, group, lengths[i])) < times.at(name(second, group, lengths[i])))
+            return lengths[i];
+    }
+    return lengths.front() - 1;
+}
+
+static std::vector<long long> powers(long long from, long long to) {
+    std::vector<long long> lengths;
+    for (long long n = from; n <= to; n *= 2) lengths.push_back(n);
+    return lengths;
+}
+
+static std::vector<long long> steps(long long from, long long to, long long step) {
+    std::vector<long long> lengths;
+    for (long long n = from; n <= to; n += step) lengths.push_back(n);
+    return lengths;
+}
+
+// Dual-Pivot Quicksort against radix sort, for the keys of 8 * sizeof(T) bits
+template <typename T>
+static void addRadixSort(const std::vector<long long> &lengths) {
+    const std::string group = std::to_string(8 * sizeof(T));
+    for (long long n : lengths) {
+        add<T>(name("quick", group, n), n, randomKeys<T>,
+               [](T *a, long long n) { HybridSort::vectorizedQuickSort(a, a + n); });
+        add<T>(name("radix", group, n), n, randomKeys<T>,
+               [](T *a, long long n) { HybridSort::radixSort(a, n); });
+    }
+}
+
+// A comparator other than std::less, so that sorting networks are not used
+struct Less {
+    bool operator()(int x, int y) const { return x < y; }
+};
+
+// Insertion sort against one partitioning step followed by insertion sort
+static void addInsertionSort(const std::vector<long long> &lengths) {
+    for (long long n : lengths) {
+        add<int>(name("insertion", "int", n), n, randomKeys<int>, [](int *a, long long n) {
+            HybridSort::insertionSort(a, 0, n - 1, true, Less());
+        });
+        add<int>(name("partition", "int", n), n, randomKeys<int>, [](int *a, long long n) {
+            HybridSort::QuickSortRange parts[3];
+            int count = HybridSort::dualPivotPartition(a, 0, n - 1, true, parts, Less());
+            for (int i = 0; i < count; i++)
+                HybridSort::insertionSort(a, parts[i].left, parts[i].right, parts[i].leftmost,
+                                          Less());
+        });
+    }
+}
+
+static void quickSort(int *a, long long n) {
+    HybridSort::quickSort(a, 0, n - 1, std::less<int>(), HybridSort::VectorizedQuickSort());
+}
+
+// Quicksort against trying to merge first, on random and nearly sorted arrays in turn
+static void addQuickSort(const std::vector<long long> &lengths) {
+    auto generate = [](long long n, long long i) {
+        return i % 2 == 0 ? randomKeys<int>(n, i) : runs(n, 2, i);
+    };
+    for (long long n : lengths) {
+        add<int>(name("quick", "mixed", n), n, generate, quickSort);
+        add<int>(name("merge", "mixed", n), n, generate, [](int *a, long long n) {
+            if (!HybridSort::mergeRuns(a, 0, n - 1, (int *) nullptr, 0, 0, 0, std::less<int>()))
+                quickSort(a, n);
+        });
+    }
+}
+
+// Quicksort against merging, on arrays of 2^18 elements made of k runs of random keys
+static void addRunCount(const std::vector<long long> &counts) {
+    const long long n = 1 << 18;
+    for (long long k : counts) {
+        auto generate = [k](long long n, long long i) { return runs(n, k, i); };
+        add<int>(name("quick", "runs", k), n, generate, quickSort);
+        add<int>(name("merge", "runs", k), n, generate, [](int *a, long long n) {
+            HybridSort::mergeRuns(a, 0, n - 1, (int *) nullptr, 0, 0, 0, std::less<int>(),
+                                  std::numeric_limits<HybridSort::Index>::max());
+        });
+    }
+}
+
+int main(int argc, char **argv) {
+    benchmark::Initialize(&argc, argv);
+    const char *profilePath = argc > 1 ? argv[1] : "HybridSortProfile.txt";
+    const char *headerPath = argc > 2 ? argv[2] : "HybridSortProfile.hpp";
+
+    const std::vector<long long> radixLengths = powers(1 << 8, 1 << 24);
+    const std::vector<long long> insertionLengths = steps(16, 128, 8);
+    const std::vector<long long> quickSortLengths = powers(32, 4096);
+    const std::vector<long long> runCounts = powers(4, 4096);
+    addRadixSort<unsigned char>(radixLengths);
+    addRadixSort<unsigned short>(radixLengths);
+    addRadixSort<unsigned int>(radixLengths);
+    addRadixSort<unsigned long long>(radixLengths);
+    addInsertionSort(insertionLengths);
+    addQuickSort(quickSortLengths);
+    addRunCount(runCounts);
+
+    Collector collector;
+    benchmark::RunSpecifiedBenchmarks(&collector);
+    const std::map<std::string, double> &times = collector.times;
+
+    // name, value, and whether it can be loaded at runtime
+    struct Threshold {
+        std::string name;
+        long long value;
+        bool runtime;
+    };
+    std::vector<Threshold> thresholds;
+    for (int bits = 8; bits <= 64; bits <<= 1) {
+        const std::string group = std::to_string(bits);
+        thresholds.push_back({"radix_sort_threshold_" + group,
+                              crossover(times, "quick", "radix", group, radixLengths), true});
+    }
+    long long value = crossover(times, "insertion", "partition", "int", insertionLengths);
+    thresholds.push_back({"insertion_sort_threshold", value < 0 ? -1 : value + 1, false});
+    value = crossover(times, "quick", "merge", "mixed", quickSortLengths);
+    thresholds.push_back({"quicksort_threshold", value, false});
+    value = crossover(times, "merge", "quick", "runs", runCounts);
+    thresholds.push_back({"max_run_count", value, false});
+
+    std::ofstream profile(profilePath), header(headerPath);
+    header << "// Thresholds measured by tuneThresholds\n";
+    header << "#ifndef _HYBRID_SORT_PROFILE_HPP_\n#define _HYBRID_SORT_PROFILE_HPP_\n";
+    for (const Threshold &t : thresholds) {
+        if (t.value < 0) continue;
+        std::string macro = "HYBRID_SORT_" + t.name;
+        std::transform(macro.begin(), macro.end(), macro.begin(), ::toupper);
+        std::cout << t.name << " " << t.value << std::endl;
+        if (t.runtime) profile << t.name << " " << t.value << "\n";
+        header << "#define " << macro << " " << t.value << "\n";
+    }
+    header << "#endif\n";
+    std::cout << "written " << profilePath << " and " << headerPath << std::endl;
+}
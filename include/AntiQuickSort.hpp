@@ -0,0 +1,114 @@
+/**
+ * Anti Quicksort
+ *
+ * Copyright (c) 2019, xehoth
+ * All rights reserved.
+ *
+ * Licensed under the MIT License;
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author xehoth
+ */
+#ifndef _ANTI_QUICK_SORT_HPP_
+#define _ANTI_QUICK_SORT_HPP_
+#include "DualPivotQuickSort.hpp"
+#include <vector>
+
+namespace HybridSort {
+
+    /**
+     * State of McIlroy's adversary ("A Killer Adversary for Quicksort").
+     * All the values start as gas, which is greater than any solid value.
+     * When two gas values are compared one of them is frozen to the next
+     * solid value, preferring the last gas value compared, which is likely
+     * the pivot. So pivots always turn out to be the smallest values.
+     */
+    struct AntiQuickSortAdversary {
+        std::vector<int> val;
+        int gas;
+        int solid;
+        int candidate;
+        long long comparisons;
+
+        explicit AntiQuickSortAdversary(int n)
+            : val(n, n - 1), gas(n - 1), solid(0), candidate(0), comparisons(0) {}
+
+        int compare(int x, int y) {
+            comparisons++;
+            if (val[x] == gas && val[y] == gas) val[x == candidate ? x : y] = solid++;
+            if (val[x] == gas) {
+                candidate = x;
+            } else if (val[y] == gas) {
+                candidate = y;
+            }
+            return val[x] - val[y];
+        }
+    };
+
+    /**
+     * An element which is compared by asking the adversary, the algorithm
+     * under attack sorts these instead of the keys.
+     */
+    struct AntiQuickSortKey {
+        int index;
+        AntiQuickSortAdversary *adversary;
+
+        int compare(const AntiQuickSortKey &o) const { return adversary->compare(index, o.index); }
+
+        bool operator<(const AntiQuickSortKey &o) const { return compare(o) < 0; }
+
+        bool operator>(const AntiQuickSortKey &o) const { return compare(o) > 0; }
+
+        bool operator<=(const AntiQuickSortKey &o) const { return compare(o) <= 0; }
+
+        bool operator>=(const AntiQuickSortKey &o) const { return compare(o) >= 0; }
+
+        bool operator==(const AntiQuickSortKey &o) const { return compare(o) == 0; }
+
+        bool operator!=(const AntiQuickSortKey &o) const { return compare(o) != 0; }
+    };
+
+    /*
+     * Let the adversary face the same sorting networks and partition kernel
+     * as int keys, so the comparisons match those of sorting the result.
+     */
+    template <>
+    struct UseSortingNetwork<AntiQuickSortKey> : std::true_type {};
+
+    template <>
+    struct DefaultPartition<AntiQuickSortKey> : DefaultPartition<int> {};
+
+    /**
+     * Generates an input on which Dual-Pivot Quicksort with the given
+     * number of partitioning levels picks the worst pivots it can. With an
+     * unlimited depth sorting it takes quadratic time.
+     *
+     * @param n the length of the input
+     * @param depth the number of partitioning levels of the sort under attack
+     * @return a permutation of 0 to n - 1
+     */
+    inline std::vector<int> antiQuickSort(int n, int depth) {
+        AntiQuickSortAdversary adversary(n);
+        std::vector<AntiQuickSortKey> keys(n);
+        for (int i = 0; i < n; i++) keys[i] = {i, &adversary};
+        if (n > 0) dualPivotQuickSort(keys.data(), 0, n - 1, true, depth);
+        return adversary.val;
+    }
+}  // namespace HybridSort
+#endif
@@ -0,0 +1,164 @@
+/**
+ * Arg Sort
+ *
+ * Copyright (c) 2019, xehoth
+ * All rights reserved.
+ *
+ * Licensed under the MIT License;
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author xehoth
+ */
+#ifndef _ARG_SORT_HPP_
+#define _ARG_SORT_HPP_
+#include "DualPivotQuickSort.hpp"
+#include "RadixSort.hpp"
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace HybridSort {
+
+    /**
+     * The radix key of an element, paired with the index of the element.
+     */
+    template <typename U, typename I>
+    struct KeyIndex {
+        U key;
+        I index;
+    };
+
+    /**
+     * Radix key of a KeyIndex, the key it holds.
+     */
+    template <typename U, typename I>
+    struct KeyIndexRadixKey {
+        using Type = U;
+
+        static Type encode(const KeyIndex<U, I> &x) {
+            return x.key;
+        }
+    };
+
+    /**
+     * Orders KeyIndex pairs by key, and pairs of equal keys by index.
+     */
+    struct KeyIndexLess {
+        template <typename U, typename I>
+        bool operator()(const KeyIndex<U, I> &x, const KeyIndex<U, I> &y) const {
+            return x.key < y.key || (x.key == y.key && x.index < y.index);
+        }
+    };
+
+    /**
+     * Projection which returns the element itself.
+     */
+    struct Identity {
+        template <typename T>
+        const T &operator()(const T &x) const {
+            return x;
+        }
+    };
+
+    /**
+     * Returns the radix keys of the projected elements of the array paired
+     * with their indices, sorted by key, the indices of equal keys in
+     * ascending order.
+     *
+     * The keys are encoded once and sorted together with their indices, by
+     * Dual-Pivot Quicksort if there are at most threshold of them, and by
+     * LSD radix sort on the keys only otherwise, which is stable, so the
+     * indices of equal keys stay in order.
+     *
+     * @param a the beginning of the elements
+     * @param n the number of elements
+     * @param proj the projection of the elements to their keys
+     * @param threshold the maximum number of elements to be sorted by Quicksort
+     */
+    template <typename Key, typename I, typename T, typename Projection>
+    std::unique_ptr<KeyIndex<typename Key::Type, I>[]> sortKeyIndices(T a, Index n,
+                                                                       Projection proj,
+                                                                       Index threshold) {
+        using P = KeyIndex<typename Key::Type, I>;
+        std::unique_ptr<P[]> p(new P[n]);
+        for (Index i = 0; i < n; i++) p[i] = {Key::encode(proj(a[i])), static_cast<I>(i)};
+        if (n <= threshold) {
+            dualPivotQuickSort(p.get(), p.get() + n, KeyIndexLess());
+        } else {
+            adaptiveRadixSort<P, KeyIndexRadixKey<typename Key::Type, I> >(p.get(), n);
+        }
+        return p;
+    }
+
+    /**
+     * Writes the indices of the elements of the array to out in the order
+     * of their radix keys, the indices of equal keys in ascending order.
+     *
+     * @param a the beginning of the elements
+     * @param n the number of elements
+     * @param out the beginning of the indices to be written
+     * @param threshold the maximum number of elements to be sorted by Quicksort
+     */
+    template <typename Key, typename I, typename T, typename O>
+    void radixArgsort(T a, Index n, O out, Index threshold) {
+        auto p = sortKeyIndices<Key, I>(a, n, Identity(), threshold);
+        for (Index i = 0; i < n; i++) out[i] = p[i].index;
+    }
+
+    /**
+     * Sorts the specified array stably by the radix keys of the projections
+     * of its elements. The keys are sorted with the indices of their
+     * elements, and then the elements are moved into place through a buffer,
+     * so each element is moved twice however large it is.
+     *
+     * @param a the array to be sorted
+     * @param n the length of the array
+     * @param proj the projection of the elements to their keys
+     * @param threshold the maximum number of elements to be sorted by Quicksort
+     */
+    template <typename Key, typename I, typename T, typename Projection>
+    void radixSortByKey(T *a, Index n, Projection proj, Index threshold) {
+        auto p = sortKeyIndices<Key, I>(a, n, proj, threshold);
+        std::unique_ptr<T[]> b(new T[n]);
+        for (Index i = 0; i < n; i++) b[i] = std::move(a[p[i].index]);
+        std::move(b.get(), b.get() + n, a);
+    }
+
+    /**
+     * Writes the indices of the elements of the array to out in the order
+     * of the comparator, the indices of equal elements in ascending order,
+     * by sorting the indices with Dual-Pivot Quicksort.
+     *
+     * @param a the beginning of the elements
+     * @param n the number of elements
+     * @param out the beginning of the indices to be written
+     * @param comp the comparator
+     */
+    template <typename I, typename T, typename O, typename Compare>
+    void comparisonArgsort(T a, Index n, O out, Compare comp) {
+        std::unique_ptr<I[]> p(new I[n]);
+        for (Index i = 0; i < n; i++) p[i] = static_cast<I>(i);
+        dualPivotQuickSort(p.get(), p.get() + n, [a, comp](I i, I j) {
+            return comp(a[i], a[j]) || (!comp(a[j], a[i]) && i < j);
+        });
+        for (Index i = 0; i < n; i++) out[i] = p[i];
+    }
+}  // namespace HybridSort
+#endif
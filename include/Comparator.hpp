@@ -0,0 +1,96 @@
+/**
+ * Comparator Traits
+ *
+ * Copyright (c) 2019, xehoth
+ * All rights reserved.
+ *
+ * Licensed under the MIT License;
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author xehoth
+ */
+#ifndef _COMPARATOR_HPP_
+#define _COMPARATOR_HPP_
+#include <functional>
+#include <type_traits>
+
+namespace HybridSort {
+
+    /**
+     * Checks if the comparator orders elements of type T by operator<,
+     * i.e. it is std::less<T> or the transparent std::less<>.
+     */
+    template <typename Compare, typename T>
+    struct IsLessCompare : std::false_type {};
+
+    template <typename T>
+    struct IsLessCompare<std::less<T>, T> : std::true_type {};
+
+    /**
+     * Checks if the comparator orders elements of type T by operator>,
+     * i.e. it is std::greater<T> or the transparent std::greater<>.
+     */
+    template <typename Compare, typename T>
+    struct IsGreaterCompare : std::false_type {};
+
+    template <typename T>
+    struct IsGreaterCompare<std::greater<T>, T> : std::true_type {};
+
+#if __cplusplus >= 201402L
+    template <typename T>
+    struct IsLessCompare<std::less<>, T> : std::true_type {};
+
+    template <typename T>
+    struct IsGreaterCompare<std::greater<>, T> : std::true_type {};
+#endif
+
+    /**
+     * Comparator of the reverse order of the given one.
+     */
+    template <typename Compare>
+    struct ReverseCompare {
+        Compare comp;
+
+        template <typename T, typename U>
+        bool operator()(const T &x, const U &y) const {
+            return comp(y, x);
+        }
+    };
+
+    /**
+     * Returns the comparator of the reverse order, std::greater for std::less
+     * and vice versa, so that the reversed order is still detected by
+     * IsLessCompare and IsGreaterCompare.
+     */
+    template <typename Compare>
+    inline ReverseCompare<Compare> reverseCompare(Compare comp) {
+        return ReverseCompare<Compare>{comp};
+    }
+
+    template <typename T>
+    inline std::greater<T> reverseCompare(std::less<T>) {
+        return std::greater<T>();
+    }
+
+    template <typename T>
+    inline std::less<T> reverseCompare(std::greater<T>) {
+        return std::less<T>();
+    }
+}  // namespace HybridSort
+#endif
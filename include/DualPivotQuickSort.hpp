@@ -30,101 +30,307 @@
 #ifndef _DUAL_PIVOT_QUICK_SORT_HPP_
 #define _DUAL_PIVOT_QUICK_SORT_HPP_
 
+#include "Comparator.hpp"
+#include "Profile.hpp"
+#include "SortingNetwork.hpp"
 #include <algorithm>
-#include <cstring>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <type_traits>
 
 namespace HybridSort {
 
     /**
-     * The maximum number of runs in merge dualPivotQuickSort.
+     * The type of array indices and lengths, wide enough for arrays of more
+     * than 2^31 elements.
      */
-    const int MAX_RUN_COUNT = 67;
+    using Index = std::ptrdiff_t;
 
     /**
-     * The maximum length of run in merge dualPivotQuickSort.
+     * The maximum number of runs which overlap much to be merged, more of
+     * them are sorted faster by Quicksort.
      */
-    const int MAX_RUN_LENGTH = 33;
+    const int MAX_RUN_COUNT = HYBRID_SORT_MAX_RUN_COUNT;
+
+    /**
+     * Runs which overlap their neighbours in at most 1 / MAX_RUN_OVERLAP of
+     * their elements, as sorted batches of increasing keys do, are merged
+     * however many they are.
+     */
+    const int MAX_RUN_OVERLAP = 16;
+
+    /**
+     * Runs shorter than this constant are extended by binary insertion sort
+     * before they are merged.
+     */
+    const int MIN_RUN_LENGTH = 32;
+
+    /**
+     * The initial number of times in a row one run has to win a merge
+     * before the merge starts galloping.
+     */
+    const int MIN_GALLOP = 7;
 
     /**
      * If the length of an array to be sorted is less than this
      * constant, Quicksort is used in preference to merge dualPivotQuickSort.
      */
-    const int QUICKSORT_THRESHOLD = 286;
+    const int QUICKSORT_THRESHOLD = HYBRID_SORT_QUICKSORT_THRESHOLD;
 
     /**
      * If the length of an array to be sorted is less than this
      * constant, insertion dualPivotQuickSort is used in preference to Quicksort.
      */
-    const int INSERTION_SORT_THRESHOLD = 47;
+    const int INSERTION_SORT_THRESHOLD = HYBRID_SORT_INSERTION_SORT_THRESHOLD;
 
     /**
-     * Sorts the specified range of the array by Dual-Pivot Quicksort.
+     * A range of the array which is left to be sorted by Dual-Pivot Quicksort.
+     */
+    struct QuickSortRange {
+        Index left;
+        Index right;
+        bool leftmost;
+    };
+
+    /**
+     * Sorts the specified tiny range of the array by insertion sort.
      *
      * @param a the array to be sorted
      * @param left the index of the first element, inclusive, to be sorted
      * @param right the index of the last element, inclusive, to be sorted
      * @param leftmost indicates if this part is the leftmost in the range
+     * @param comp the comparator
      */
-    template <typename T>
-    void dualPivotQuickSort(T *a, int left, int right, bool leftmost) {
-        int length = right - left + 1;
+    template <typename T, typename Compare = std::less<T> >
+    void insertionSort(T *a, Index left, Index right, bool leftmost, Compare comp = Compare()) {
+        if (leftmost) {
+            /*
+             * Traditional (without sentinel) insertion dualPivotQuickSort,
+             * optimized for server VM, is used in case of
+             * the leftmost part.
+             */
+            for (Index i = left, j = i; i < right; j = ++i) {
+                T ai = a[i + 1];
+                while (comp(ai, a[j])) {
+                    a[j + 1] = a[j];
+                    if (j-- == left) break;
+                }
+                a[j + 1] = ai;
+            }
+        } else {
+            /*
+             * Skip the longest ascending sequence.
+             */
+            do {
+                if (left >= right) return;
+                ++left;
+            } while (!comp(a[left], a[left - 1]));
 
-        // Use insertion dualPivotQuickSort on tiny arrays
-        if (length < INSERTION_SORT_THRESHOLD) {
-            if (leftmost) {
-                /*
-                 * Traditional (without sentinel) insertion dualPivotQuickSort,
-                 * optimized for server VM, is used in case of
-                 * the leftmost part.
-                 */
-                for (int i = left, j = i; i < right; j = ++i) {
-                    T ai = a[i + 1];
-                    while (ai < a[j]) {
-                        a[j + 1] = a[j];
-                        if (j-- == left) break;
-                    }
-                    a[j + 1] = ai;
+            /*
+             * Every element from adjoining part plays the role
+             * of sentinel, therefore this allows us to avoid the
+             * left range check on each iteration. Moreover, we use
+             * the more optimized algorithm, so called pair insertion
+             * dualPivotQuickSort, which is faster (in the context of Quicksort)
+             * than traditional implementation of insertion dualPivotQuickSort.
+             */
+            for (Index k = left; ++left <= right; k = ++left) {
+                T a1 = a[k], a2 = a[left];
+
+                if (comp(a1, a2)) {
+                    a2 = a1;
+                    a1 = a[left];
                 }
-            } else {
-                /*
-                 * Skip the longest ascending sequence.
-                 */
-                do {
-                    if (left >= right) return;
-                    ++left;
-                } while (a[left] >= a[left - 1]);
+                while (comp(a1, a[--k])) a[k + 2] = a[k];
+                a[++k + 1] = a1;
 
-                /*
-                 * Every element from adjoining part plays the role
-                 * of sentinel, therefore this allows us to avoid the
-                 * left range check on each iteration. Moreover, we use
-                 * the more optimized algorithm, so called pair insertion
-                 * dualPivotQuickSort, which is faster (in the context of Quicksort)
-                 * than traditional implementation of insertion dualPivotQuickSort.
-                 */
-                for (int k = left; ++left <= right; k = ++left) {
-                    T a1 = a[k], a2 = a[left];
+                while (comp(a2, a[--k])) a[k + 1] = a[k];
+                a[k + 1] = a2;
+            }
+            T last = a[right];
 
-                    if (a1 < a2) {
-                        a2 = a1;
-                        a1 = a[left];
-                    }
-                    while (a1 < a[--k]) a[k + 2] = a[k];
-                    a[++k + 1] = a1;
+            while (comp(last, a[--right])) a[right + 1] = a[right];
+            a[right + 1] = last;
+        }
+    }
 
-                    while (a2 < a[--k]) a[k + 1] = a[k];
-                    a[k + 1] = a2;
+    /**
+     * If the length of an array to be sorted is less than this value, it is
+     * sorted by tinySort instead of being partitioned. Sorting networks are
+     * cheap enough that partitioning down to their size pays off.
+     */
+    template <typename T, typename Compare = std::less<T> >
+    struct TinySortThreshold {
+        static const int value = UseSortingNetwork<T, Compare>::value
+                                     ? SORTING_NETWORK_THRESHOLD + 1
+                                     : INSERTION_SORT_THRESHOLD;
+    };
+
+    template <typename T, typename Compare>
+    inline void tinySort(T *a, Index left, Index right, bool leftmost, Compare comp,
+                         std::true_type) {
+        if (right - left < SORTING_NETWORK_THRESHOLD) {
+            if (left < right) sortingNetwork(a + left, right - left + 1, comp);
+        } else {
+            insertionSort(a, left, right, leftmost, comp);
+        }
+    }
+
+    template <typename T, typename Compare>
+    inline void tinySort(T *a, Index left, Index right, bool leftmost, Compare comp,
+                         std::false_type) {
+        insertionSort(a, left, right, leftmost, comp);
+    }
+
+    /**
+     * Sorts the specified tiny range of the array by a sorting network if
+     * it is short enough and its type allows, and by insertion sort otherwise.
+     *
+     * @param a the array to be sorted
+     * @param left the index of the first element, inclusive, to be sorted
+     * @param right the index of the last element, inclusive, to be sorted
+     * @param leftmost indicates if this part is the leftmost in the range
+     * @param comp the comparator
+     */
+    template <typename T, typename Compare = std::less<T> >
+    inline void tinySort(T *a, Index left, Index right, bool leftmost, Compare comp = Compare()) {
+        tinySort(a, left, right, leftmost, comp, UseSortingNetwork<T, Compare>());
+    }
+
+    /**
+     * Partition kernel which moves each element with data-dependent branches.
+     */
+    struct BranchPartition {};
+
+    /**
+     * Branchless partition kernel in the style of BlockQuicksort, which
+     * avoids branch mispredictions on random primitive keys.
+     */
+    struct BlockPartition {};
+
+    /**
+     * The number of elements whose offsets are buffered by BlockPartition.
+     */
+    const int PARTITION_BLOCK_SIZE = 128;
+
+    /**
+     * The partition kernel used by default, BlockPartition for primitive
+     * keys, whose comparisons are cheap enough that mispredicted branches
+     * dominate, and BranchPartition otherwise.
+     */
+    template <typename T>
+    struct DefaultPartition {
+        using type = typename std::conditional<IsPrimitiveKey<T>::value, BlockPartition,
+                                               BranchPartition>::type;
+    };
+
+    /**
+     * Partitions the range [less, great] of the array by the two pivots,
+     * moving each element with branches.
+     *
+     *   left part           center part                   right part
+     * +--------------------------------------------------------------+
+     * |  < pivot1  |  pivot1 <= && <= pivot2  |    ?    |  > pivot2  |
+     * +--------------------------------------------------------------+
+     *               ^                          ^       ^
+     *               |                          |       |
+     *              less                        k     great
+     *
+     * Invariants:
+     *
+     *              all in (left, less)   < pivot1
+     *    pivot1 <= all in [less, k)     <= pivot2
+     *              all in (great, right) > pivot2
+     *
+     * Pointer k is the first index of ?-part.
+     */
+    template <typename T, typename Compare>
+    void partitionByPivots(T *a, Index &less, Index &great, T pivot1, T pivot2, Compare comp,
+                           BranchPartition) {
+        for (Index k = less - 1; ++k <= great;) {
+            T ak = a[k];
+            if (comp(ak, pivot1)) {  // Move a[k] to left part
+                std::swap(a[k], a[less++]);
+            } else if (comp(pivot2, ak)) {  // Move a[k] to right part
+                while (comp(pivot2, a[great]))
+                    if (great-- == k) return;
+                if (comp(a[great], pivot1)) {  // a[great] <= pivot2
+                    a[k] = a[less];
+                    a[less++] = a[great];
+                } else {  // pivot1 <= a[great] <= pivot2
+                    a[k] = a[great];
                 }
-                T last = a[right];
+                a[great--] = ak;
+            }
+        }
+    }
 
-                while (last < a[--right]) a[right + 1] = a[right];
-                a[right + 1] = last;
+    /**
+     * Moves the elements of [lo, hi) of the array which satisfy pred to its
+     * beginning by block Lomuto partitioning. The offsets of the matching
+     * elements of each block are collected without branches, and then the
+     * elements are swapped in a batch.
+     *
+     * @param a the array to be partitioned
+     * @param lo the index of the first element, inclusive, to be partitioned
+     * @param hi the index of the last element, exclusive, to be partitioned
+     * @param pred the predicate
+     * @return the index after the last element which satisfies pred
+     */
+    template <typename T, typename Predicate>
+    Index blockPartition(T *a, Index lo, Index hi, Predicate pred) {
+        unsigned char offsets[PARTITION_BLOCK_SIZE];
+        Index j = lo;
+        for (Index i = lo; i < hi; i += PARTITION_BLOCK_SIZE) {
+            const int size = static_cast<int>(std::min<Index>(PARTITION_BLOCK_SIZE, hi - i));
+            int num = 0;
+            for (int k = 0; k < size; k++) {
+                offsets[num] = static_cast<unsigned char>(k);
+                num += pred(a[i + k]);
             }
-            return;
+            for (int k = 0; k < num; k++) std::swap(a[j++], a[i + offsets[k]]);
         }
+        return j;
+    }
+
+    /**
+     * Partitions the range [less, great] of the array by the two pivots with
+     * two branchless block partitioning passes, the first one splits off the
+     * elements less than pivot1, the second one those greater than pivot2.
+     */
+    template <typename T, typename Compare>
+    void partitionByPivots(T *a, Index &less, Index &great, T pivot1, T pivot2, Compare comp,
+                           BlockPartition) {
+        Index center = blockPartition(a, less, great + 1,
+                                      [pivot1, comp](const T &x) { return comp(x, pivot1); });
+        Index right = blockPartition(a, center, great + 1,
+                                     [pivot2, comp](const T &x) { return !comp(pivot2, x); });
+        less = center;
+        great = right - 1;
+    }
+
+    /**
+     * Partitions the specified range of the array by one step of
+     * Dual-Pivot Quicksort. The range must not be shorter than
+     * TinySortThreshold<T>::value.
+     *
+     * @param a the array to be partitioned
+     * @param left the index of the first element, inclusive, to be partitioned
+     * @param right the index of the last element, inclusive, to be partitioned
+     * @param leftmost indicates if this part is the leftmost in the range
+     * @param parts receives the ranges which are left to be sorted
+     * @param comp the comparator
+     * @return the number of ranges in parts, 2 or 3
+     */
+    template <typename T, typename Kernel = typename DefaultPartition<T>::type,
+              typename Compare = std::less<T> >
+    int dualPivotPartition(T *a, Index left, Index right, bool leftmost, QuickSortRange *parts,
+                           Compare comp = Compare()) {
+        Index length = right - left + 1;
 
         // Inexpensive approximation of length / 7
-        int seventh = (length >> 3) + (length >> 6) + 1;
+        Index seventh = (length >> 3) + (length >> 6) + 1;
 
         /*
          * Sort five evenly spaced elements around (and including) the
@@ -133,42 +339,44 @@ namespace HybridSort {
          * these elements was empirically determined to work well on
          * a wide variety of inputs.
          */
-        int e3 = static_cast<unsigned int>(left + right) >> 1;  // The midpoint
-        int e2 = e3 - seventh;
-        int e1 = e2 - seventh;
-        int e4 = e3 + seventh;
-        int e5 = e4 + seventh;
+        Index e3 = left + ((right - left) >> 1);  // The midpoint
+        Index e2 = e3 - seventh;
+        Index e1 = e2 - seventh;
+        Index e4 = e3 + seventh;
+        Index e5 = e4 + seventh;
 
         // Sort these elements using insertion dualPivotQuickSort
-        if (a[e2] < a[e1]) std::swap(a[e2], a[e1]);
+        if (comp(a[e2], a[e1])) std::swap(a[e2], a[e1]);
 
-        if (a[e3] < a[e2]) {
+        if (comp(a[e3], a[e2])) {
             std::swap(a[e3], a[e2]);
-            if (a[e2] < a[e1]) std::swap(a[e2], a[e1]);
+            if (comp(a[e2], a[e1])) std::swap(a[e2], a[e1]);
         }
-        if (a[e4] < a[e3]) {
+        if (comp(a[e4], a[e3])) {
             std::swap(a[e4], a[e3]);
-            if (a[e3] < a[e2]) {
+            if (comp(a[e3], a[e2])) {
                 std::swap(a[e3], a[e2]);
-                if (a[e2] < a[e1]) std::swap(a[e2], a[e1]);
+                if (comp(a[e2], a[e1])) std::swap(a[e2], a[e1]);
             }
         }
-        if (a[e5] < a[e4]) {
+        if (comp(a[e5], a[e4])) {
             std::swap(a[e5], a[e4]);
-            if (a[e4] < a[e3]) {
+            if (comp(a[e4], a[e3])) {
                 std::swap(a[e4], a[e3]);
-                if (a[e3] < a[e2]) {
+                if (comp(a[e3], a[e2])) {
                     std::swap(a[e3], a[e2]);
-                    if (a[e2] < a[e1]) std::swap(a[e2], a[e1]);
+                    if (comp(a[e2], a[e1])) std::swap(a[e2], a[e1]);
                 }
             }
         }
 
         // Pointers
-        int less = left;    // The index of the first element of center part
-        int great = right;  // The index before the first element of right part
+        Index less = left;    // The index of the first element of center part
+        Index great = right;  // The index before the first element of right part
 
-        if (a[e1] != a[e2] && a[e2] != a[e3] && a[e3] != a[e4] && a[e4] != a[e5]) {
+        // The five elements are sorted, so they are distinct if each is less than the next
+        if (comp(a[e1], a[e2]) && comp(a[e2], a[e3]) && comp(a[e3], a[e4]) &&
+            comp(a[e4], a[e5])) {
             /*
              * Use the second and fourth of the five sorted elements as pivots.
              * These values are inexpensive approximations of the first and
@@ -189,47 +397,12 @@ namespace HybridSort {
             /*
              * Skip elements, which are less or greater than pivot values.
              */
-            while (a[++less] < pivot1)
+            while (comp(a[++less], pivot1))
                 ;
-            while (a[--great] > pivot2)
+            while (comp(pivot2, a[--great]))
                 ;
 
-        /*
-         * Partitioning:
-         *
-         *   left part           center part                   right part
-         * +--------------------------------------------------------------+
-         * |  < pivot1  |  pivot1 <= && <= pivot2  |    ?    |  > pivot2  |
-         * +--------------------------------------------------------------+
-         *               ^                          ^       ^
-         *               |                          |       |
-         *              less                        k     great
-         *
-         * Invariants:
-         *
-         *              all in (left, less)   < pivot1
-         *    pivot1 <= all in [less, k)     <= pivot2
-         *              all in (great, right) > pivot2
-         *
-         * Pointer k is the first index of ?-part.
-         */
-        outer1:
-            for (int k = less - 1; ++k <= great;) {
-                T ak = a[k];
-                if (ak < pivot1) {  // Move a[k] to left part
-                    std::swap(a[k], a[less++]);
-                } else if (ak > pivot2) {  // Move a[k] to right part
-                    while (a[great] > pivot2)
-                        if (great-- == k) goto outer1;
-                    if (a[great] < pivot1) {  // a[great] <= pivot2
-                        a[k] = a[less];
-                        a[less++] = a[great];
-                    } else {  // pivot1 <= a[great] <= pivot2
-                        a[k] = a[great];
-                    }
-                    a[great--] = ak;
-                }
-            }
+            partitionByPivots(a, less, great, pivot1, pivot2, comp, Kernel());
 
             // Swap pivots into their const positions
             a[left] = a[less - 1];
@@ -237,9 +410,9 @@ namespace HybridSort {
             a[right] = a[great + 1];
             a[great + 1] = pivot2;
 
-            // Sort left and right parts recursively, excluding known pivots
-            dualPivotQuickSort(a, left, less - 2, leftmost);
-            dualPivotQuickSort(a, great + 2, right, false);
+            // Left and right parts are left to be sorted, excluding known pivots
+            parts[0] = {left, less - 2, leftmost};
+            parts[1] = {great + 2, right, false};
 
             /*
              * If center part is too large (comprises > 4/7 of the array),
@@ -249,8 +422,8 @@ namespace HybridSort {
                 /*
                  * Skip elements, which are equal to pivot values.
                  */
-                while (a[less] == pivot1) ++less;
-                while (a[great] == pivot2) --great;
+                while (!comp(pivot1, a[less])) ++less;
+                while (!comp(a[great], pivot2)) --great;
 
             /*
              * Partitioning:
@@ -272,24 +445,25 @@ namespace HybridSort {
              * Pointer k is the first index of ?-part.
              */
             outer2:
-                for (int k = less - 1; ++k <= great;) {
+                for (Index k = less - 1; ++k <= great;) {
                     T ak = a[k];
-                    if (ak == pivot1) {  // Move a[k] to left part
+                    if (!comp(pivot1, ak)) {  // Move a[k] to left part
                         std::swap(a[k], a[less++]);
-                    } else if (ak == pivot2) {  // Move a[k] to right part
-                        while (a[great] == pivot2)
+                    } else if (!comp(ak, pivot2)) {  // Move a[k] to right part
+                        while (!comp(a[great], pivot2))
                             if (great-- == k) goto outer2;
-                        if (a[great] == pivot1) {  // a[great] < pivot2
+                        if (!comp(pivot1, a[great])) {  // a[great] < pivot2
                             a[k] = a[less];
                             /*
                              * Even though a[great] equals to pivot1, the
                              * assignment a[less] = pivot1 may be incorrect,
                              * if a[great] and pivot1 are floating-point zeros
-                             * of different signs. Therefore in float and
-                             * double sorting methods we have to use more
-                             * accurate assignment a[less] = a[great].
+                             * of different signs, or distinct elements which
+                             * the comparator considers equal. Therefore we
+                             * have to use more accurate assignment
+                             * a[less] = a[great].
                              */
-                            a[less++] = pivot1;
+                            a[less++] = a[great];
                         } else {  // pivot1 < a[great] < pivot2
                             a[k] = a[great];
                         }
@@ -298,8 +472,9 @@ namespace HybridSort {
                 }
             }
 
-            // Sort center part recursively
-            dualPivotQuickSort(a, less, great, false);
+            // Center part is left to be sorted
+            parts[2] = {less, great, false};
+            return 3;
 
         } else {  // Partitioning with one pivot
             /*
@@ -328,14 +503,13 @@ namespace HybridSort {
              *
              * Pointer k is the first index of ?-part.
              */
-            for (int k = less; k <= great; ++k) {
-                if (a[k] == pivot) continue;
+            for (Index k = less; k <= great; ++k) {
                 T ak = a[k];
-                if (ak < pivot) {  // Move a[k] to left part
+                if (comp(ak, pivot)) {  // Move a[k] to left part
                     std::swap(a[k], a[less++]);
-                } else {  // a[k] > pivot - Move a[k] to right part
-                    while (a[great] > pivot) --great;
-                    if (a[great] < pivot) {  // a[great] <= pivot
+                } else if (comp(pivot, ak)) {  // Move a[k] to right part
+                    while (comp(pivot, a[great])) --great;
+                    if (comp(a[great], pivot)) {  // a[great] <= pivot
                         a[k] = a[less];
                         a[less++] = a[great];
                     } else {  // a[great] == pivot
@@ -343,143 +517,669 @@ namespace HybridSort {
                          * Even though a[great] equals to pivot, the
                          * assignment a[k] = pivot may be incorrect,
                          * if a[great] and pivot are floating-point
-                         * zeros of different signs. Therefore in float
-                         * and double sorting methods we have to use
-                         * more accurate assignment a[k] = a[great].
+                         * zeros of different signs. Therefore we have
+                         * to use more accurate assignment a[k] = a[great].
                          */
-                        a[k] = pivot;
+                        a[k] = a[great];
                     }
                     a[great--] = ak;
                 }
             }
 
             /*
-             * Sort left and right parts recursively.
+             * Left and right parts are left to be sorted.
              * All elements from center part are equal
              * and, therefore, already sorted.
              */
-            dualPivotQuickSort(a, left, less - 1, leftmost);
-            dualPivotQuickSort(a, great + 1, right, false);
+            parts[0] = {left, less - 1, leftmost};
+            parts[1] = {great + 1, right, false};
+            return 2;
         }
     }
 
     /**
-     * Sorts the specified range of the array using the given
-     * workspace array slice if possible for merging
+     * Sorts the specified range of the array by heapsort, which is used
+     * when Dual-Pivot Quicksort recurses too deep.
      *
      * @param a the array to be sorted
      * @param left the index of the first element, inclusive, to be sorted
      * @param right the index of the last element, inclusive, to be sorted
-     * @param work a workspace array (slice)
-     * @param workBase origin of usable space in work array
-     * @param workLen usable size of work array
+     * @param comp the comparator
      */
-    template <typename T>
-    inline void dualPivotQuickSort(T *a, int left, int right, T *work, int workBase, int workLen,
-                                   int workLength) {
-        // Use Quicksort on small arrays
-        if (right - left < QUICKSORT_THRESHOLD) {
-            dualPivotQuickSort(a, left, right, true);
+    template <typename T, typename Compare = std::less<T> >
+    void heapSort(T *a, Index left, Index right, Compare comp = Compare()) {
+        std::make_heap(a + left, a + right + 1, comp);
+        std::sort_heap(a + left, a + right + 1, comp);
+    }
+
+    /**
+     * The number of partitioning levels Dual-Pivot Quicksort may use on a
+     * range of the given length before the range is heap sorted instead,
+     * twice its binary logarithm as in introsort.
+     *
+     * @param length the length of the range
+     */
+    inline int quickSortDepth(Index length) {
+        int depth = 0;
+        while ((length >>= 1) > 0) depth += 2;
+        return depth;
+    }
+
+    /**
+     * Sorts the specified range of the array by Dual-Pivot Quicksort. Ranges
+     * which are still long after depth partitioning levels are heap sorted,
+     * so the sort is O(n log n) even on adversarial inputs.
+     *
+     * @param a the array to be sorted
+     * @param left the index of the first element, inclusive, to be sorted
+     * @param right the index of the last element, inclusive, to be sorted
+     * @param leftmost indicates if this part is the leftmost in the range
+     * @param depth the number of partitioning levels left
+     * @param comp the comparator
+     */
+    template <typename T, typename Kernel = typename DefaultPartition<T>::type,
+              typename Compare = std::less<T> >
+    void dualPivotQuickSort(T *a, Index left, Index right, bool leftmost, int depth,
+                            Compare comp = Compare()) {
+        // Use a sorting network or insertion sort on tiny arrays
+        if (right - left + 1 < TinySortThreshold<T, Compare>::value) {
+            tinySort(a, left, right, leftmost, comp);
             return;
         }
 
-        /*
-         * Index run[i] is the start of i-th run
-         * (ascending or descending sequence).
-         */
-        static int run[MAX_RUN_COUNT + 1];
-        memset(run, 0, sizeof(run));
-        int count = 0;
-        run[0] = left;
-
-        // Check if the array is nearly sorted
-        for (int k = left; k < right; run[count] = k) {
-            if (a[k] < a[k + 1]) {  // ascending
-                while (++k <= right && a[k - 1] <= a[k])
-                    ;
-            } else if (a[k] > a[k + 1]) {  // descending
-                while (++k <= right && a[k - 1] >= a[k])
-                    ;
-                for (int lo = run[count] - 1, hi = k; ++lo < --hi;) std::swap(a[lo], a[hi]);
-            } else {  // equal
-                for (int m = MAX_RUN_LENGTH; ++k <= right && a[k - 1] == a[k];) {
-                    if (--m == 0) {
-                        dualPivotQuickSort(a, left, right, true);
-                        return;
-                    }
+        // Bad pivots kept the range long for too many levels
+        if (depth == 0) {
+            heapSort(a, left, right, comp);
+            return;
+        }
+
+        // Sort the parts recursively
+        QuickSortRange parts[3];
+        int count = dualPivotPartition<T, Kernel>(a, left, right, leftmost, parts, comp);
+        for (int i = 0; i < count; i++)
+            dualPivotQuickSort<T, Kernel>(a, parts[i].left, parts[i].right, parts[i].leftmost,
+                                          depth - 1, comp);
+    }
+
+    /**
+     * Sorts the specified range of the array by Dual-Pivot Quicksort.
+     *
+     * @param a the array to be sorted
+     * @param left the index of the first element, inclusive, to be sorted
+     * @param right the index of the last element, inclusive, to be sorted
+     * @param leftmost indicates if this part is the leftmost in the range
+     */
+    template <typename T, typename Kernel = typename DefaultPartition<T>::type>
+    void dualPivotQuickSort(T *a, Index left, Index right, bool leftmost) {
+        dualPivotQuickSort<T, Kernel>(a, left, right, leftmost, quickSortDepth(right - left + 1));
+    }
+
+    /**
+     * Rearranges the specified range of the array so that a[k] is the
+     * element which would be there if the range was sorted, no element
+     * before it is greater and no element after it is less.
+     *
+     * Only the part of each Dual-Pivot Quicksort partition which contains k
+     * is partitioned further, which takes O(n) expected time. Ranges which
+     * are still long after as many levels as the sort may use are heap
+     * sorted.
+     *
+     * @param a the array
+     * @param left the index of the first element, inclusive, of the range
+     * @param right the index of the last element, inclusive, of the range
+     * @param k the index of the element to be selected
+     * @param leftmost indicates if this part is the leftmost in the range
+     * @param comp the comparator
+     */
+    template <typename T, typename Kernel = typename DefaultPartition<T>::type,
+              typename Compare = std::less<T> >
+    void dualPivotSelect(T *a, Index left, Index right, Index k, bool leftmost,
+                         Compare comp = Compare()) {
+        for (int depth = quickSortDepth(right - left + 1);; depth--) {
+            if (right - left + 1 < TinySortThreshold<T, Compare>::value) {
+                tinySort(a, left, right, leftmost, comp);
+                return;
+            }
+            if (depth == 0) {
+                heapSort(a, left, right, comp);
+                return;
+            }
+
+            QuickSortRange parts[3];
+            int count = dualPivotPartition<T, Kernel>(a, left, right, leftmost, parts, comp);
+            int i = 0;
+            while (i < count && (k < parts[i].left || parts[i].right < k)) i++;
+
+            // a[k] is a pivot or equal to one, which are in their final positions
+            if (i == count) return;
+            left = parts[i].left;
+            right = parts[i].right;
+            leftmost = parts[i].leftmost;
+        }
+    }
+
+    /**
+     * Quicksort engine which sorts the ranges left by the merge wrapper
+     * with the scalar Dual-Pivot Quicksort.
+     */
+    struct ScalarQuickSort {};
+
+    template <typename T, typename Compare>
+    inline void quickSort(T *a, Index left, Index right, Compare comp, ScalarQuickSort) {
+        dualPivotQuickSort(a, left, right, true, quickSortDepth(right - left + 1), comp);
+    }
+
+    /**
+     * Sorts a[lo, hi) by binary insertion sort, given that a[lo, start) is
+     * already sorted. Equal elements keep their order.
+     *
+     * @param a the array to be sorted
+     * @param lo the index of the first element, inclusive, to be sorted
+     * @param hi the index of the last element, exclusive, to be sorted
+     * @param start the index of the first element which is not in order
+     * @param comp the comparator
+     */
+    template <typename T, typename Compare>
+    void binaryInsertionSort(T *a, Index lo, Index hi, Index start, Compare comp) {
+        for (; start < hi; start++) {
+            T pivot = std::move(a[start]);
+            Index l = lo, r = start;
+            while (l < r) {
+                Index m = l + ((r - l) >> 1);
+                if (comp(pivot, a[m])) {
+                    r = m;
+                } else {
+                    l = m + 1;
                 }
             }
+            std::move_backward(a + l, a + start, a + start + 1);
+            a[l] = std::move(pivot);
+        }
+    }
 
-            /*
-             * The array is not highly structured,
-             * use Quicksort instead of merge dualPivotQuickSort.
-             */
-            if (++count == MAX_RUN_COUNT) {
-                dualPivotQuickSort(a, left, right, true);
-                return;
+    /**
+     * Returns the position of the first element of the sorted a[0, len)
+     * which is not less than key, galloping from a[hint] before the binary
+     * search, so keys near the hint are found in O(log distance) steps.
+     *
+     * @param key the key to search for
+     * @param a the sorted array to search in
+     * @param len the length of the array, positive
+     * @param hint the index to start the search at
+     * @param comp the comparator
+     */
+    template <typename T, typename Compare>
+    Index gallopLeft(const T &key, const T *a, Index len, Index hint, Compare comp) {
+        Index lastOfs = 0, ofs = 1;
+        if (comp(a[hint], key)) {
+            // Gallop right until a[hint + lastOfs] < key <= a[hint + ofs]
+            const Index maxOfs = len - hint;
+            while (ofs < maxOfs && comp(a[hint + ofs], key)) {
+                lastOfs = ofs;
+                ofs = (ofs << 1) + 1;
+            }
+            if (ofs > maxOfs) ofs = maxOfs;
+            lastOfs += hint;
+            ofs += hint;
+        } else {
+            // Gallop left until a[hint - ofs] < key <= a[hint - lastOfs]
+            const Index maxOfs = hint + 1;
+            while (ofs < maxOfs && !comp(a[hint - ofs], key)) {
+                lastOfs = ofs;
+                ofs = (ofs << 1) + 1;
             }
+            if (ofs > maxOfs) ofs = maxOfs;
+            const Index k = lastOfs;
+            lastOfs = hint - ofs;
+            ofs = hint - k;
         }
 
-        // Check special cases
-        // Implementation note: variable "right" is increased by 1.
-        if (run[count] == right++) {  // The last run contains one element
-            run[++count] = right;
-        } else if (count == 1) {  // The array is already sorted
-            return;
+        // Now a[lastOfs] < key <= a[ofs], find the position in between
+        for (++lastOfs; lastOfs < ofs;) {
+            Index m = lastOfs + ((ofs - lastOfs) >> 1);
+            if (comp(a[m], key)) {
+                lastOfs = m + 1;
+            } else {
+                ofs = m;
+            }
+        }
+        return ofs;
+    }
+
+    /**
+     * Returns the position after the last element of the sorted a[0, len)
+     * which is not greater than key, galloping from a[hint] like gallopLeft.
+     *
+     * @param key the key to search for
+     * @param a the sorted array to search in
+     * @param len the length of the array, positive
+     * @param hint the index to start the search at
+     * @param comp the comparator
+     */
+    template <typename T, typename Compare>
+    Index gallopRight(const T &key, const T *a, Index len, Index hint, Compare comp) {
+        Index lastOfs = 0, ofs = 1;
+        if (comp(key, a[hint])) {
+            // Gallop left until a[hint - ofs] <= key < a[hint - lastOfs]
+            const Index maxOfs = hint + 1;
+            while (ofs < maxOfs && comp(key, a[hint - ofs])) {
+                lastOfs = ofs;
+                ofs = (ofs << 1) + 1;
+            }
+            if (ofs > maxOfs) ofs = maxOfs;
+            const Index k = lastOfs;
+            lastOfs = hint - ofs;
+            ofs = hint - k;
+        } else {
+            // Gallop right until a[hint + lastOfs] <= key < a[hint + ofs]
+            const Index maxOfs = len - hint;
+            while (ofs < maxOfs && !comp(key, a[hint + ofs])) {
+                lastOfs = ofs;
+                ofs = (ofs << 1) + 1;
+            }
+            if (ofs > maxOfs) ofs = maxOfs;
+            lastOfs += hint;
+            ofs += hint;
         }
 
-        // Determine alternation base for merge
-        char odd = 0;
-        for (int n = 1; (n <<= 1) < count; odd ^= 1)
-            ;
-
-        // Use or create temporary array b for merging
-        T *b;                     // temp array; alternates with a
-        int ao, bo;               // array offsets from 'left'
-        int blen = right - left;  // space needed for b
-        if (work == nullptr || workLen < blen || workBase + blen > workLength) {
-            work = new T[blen]();
-            workBase = 0;
+        // Now a[lastOfs] <= key < a[ofs], find the position in between
+        for (++lastOfs; lastOfs < ofs;) {
+            Index m = lastOfs + ((ofs - lastOfs) >> 1);
+            if (comp(key, a[m])) {
+                ofs = m;
+            } else {
+                lastOfs = m + 1;
+            }
+        }
+        return ofs;
+    }
+
+    /**
+     * Merges the adjacent runs a[base1, base1 + len1) and a[base2, base2 + len2)
+     * from the left, moving the first one, which must not be longer, to tmp.
+     * The merge gallops while one run keeps winning, and minGallop adapts
+     * to how often galloping pays off. Equal elements keep their order.
+     *
+     * The last element of the first run must be greater than all elements
+     * of the second run, and the first element of the second run less than
+     * all elements of the first run, as mergeAt ensures.
+     */
+    template <typename T, typename Compare>
+    void mergeLow(T *a, Index base1, Index len1, Index base2, Index len2, T *tmp, int &minGallop,
+                  Compare comp) {
+        std::move(a + base1, a + base1 + len1, tmp);
+        Index c1 = 0, c2 = base2, dest = base1;
+        int gallop = minGallop;  // A local copy, which stores to the array cannot alias
+        a[dest++] = std::move(a[c2++]);
+        if (--len2 == 0 || len1 == 1) goto outer;
+
+        // Until one run is exhausted, or only the largest element of the first run is left
+        for (;;) {
+            Index count1 = 0, count2 = 0;  // Times in a row each run won
+
+            /*
+             * Merge one element at a time until one run starts winning
+             * consistently. The element is selected without branches, which
+             * random keys would mispredict half of the time.
+             */
+            do {
+                const Index second = comp(a[c2], tmp[c1]);
+                a[dest++] = std::move(second ? a[c2] : tmp[c1]);
+                c2 += second;
+                len2 -= second;
+                c1 += 1 - second;
+                len1 -= 1 - second;
+                count2 = (count2 + 1) & -second;
+                count1 = (count1 + 1) & (second - 1);
+            } while (len2 != 0 && len1 != 1 && (count1 | count2) < gallop);
+            if (len2 == 0 || len1 == 1) goto outer;
+
+            // Gallop until neither run wins consistently
+            do {
+                count1 = gallopRight(a[c2], tmp + c1, len1, 0, comp);
+                if (count1 != 0) {
+                    std::move(tmp + c1, tmp + c1 + count1, a + dest);
+                    dest += count1;
+                    c1 += count1;
+                    len1 -= count1;
+                    if (len1 <= 1) goto outer;
+                }
+                a[dest++] = std::move(a[c2++]);
+                if (--len2 == 0) goto outer;
+
+                count2 = gallopLeft(tmp[c1], a + c2, len2, 0, comp);
+                if (count2 != 0) {
+                    std::move(a + c2, a + c2 + count2, a + dest);
+                    dest += count2;
+                    c2 += count2;
+                    len2 -= count2;
+                    if (len2 == 0) goto outer;
+                }
+                a[dest++] = std::move(tmp[c1++]);
+                if (--len1 == 1) goto outer;
+                gallop--;
+            } while (count1 >= MIN_GALLOP || count2 >= MIN_GALLOP);
+            if (gallop < 0) gallop = 0;
+            gallop += 2;  // Penalize leaving galloping mode
         }
-        if (odd == 0) {
-            memcpy(work + workBase, a + left, sizeof(T) * blen);
-            b = a;
-            bo = 0;
-            a = work;
-            ao = workBase - left;
+
+        outer:
+        minGallop = gallop;
+        if (len1 == 1) {
+            std::move(a + c2, a + c2 + len2, a + dest);
+            a[dest + len2] = std::move(tmp[c1]);
         } else {
-            b = work;
-            ao = 0;
-            bo = workBase - left;
+            std::move(tmp + c1, tmp + c1 + len1, a + dest);
         }
+    }
 
-        // Merging
-        for (int last; count > 1; count = last) {
-            for (int k = (last = 0) + 2; k <= count; k += 2) {
-                int hi = run[k], mi = run[k - 1];
-                for (int i = run[k - 2], p = i, q = mi; i < hi; ++i) {
-                    if (q >= hi || (p < mi && a[p + ao] <= a[q + ao])) {
-                        b[i + bo] = a[p++ + ao];
-                    } else {
-                        b[i + bo] = a[q++ + ao];
-                    }
+    /**
+     * Merges the adjacent runs a[base1, base1 + len1) and a[base2, base2 + len2)
+     * from the right, moving the second one, which must not be longer, to
+     * tmp. It is the mirror image of mergeLow.
+     */
+    template <typename T, typename Compare>
+    void mergeHigh(T *a, Index base1, Index len1, Index base2, Index len2, T *tmp, int &minGallop,
+                   Compare comp) {
+        std::move(a + base2, a + base2 + len2, tmp);
+        Index c1 = base1 + len1 - 1, c2 = len2 - 1, dest = base2 + len2 - 1;
+        int gallop = minGallop;
+        a[dest--] = std::move(a[c1--]);
+        if (--len1 == 0 || len2 == 1) goto outer;
+
+        // Until one run is exhausted, or only the smallest element of the second run is left
+        for (;;) {
+            Index count1 = 0, count2 = 0;
+
+            do {
+                const Index first = comp(tmp[c2], a[c1]);
+                a[dest--] = std::move(first ? a[c1] : tmp[c2]);
+                c1 -= first;
+                len1 -= first;
+                c2 -= 1 - first;
+                len2 -= 1 - first;
+                count1 = (count1 + 1) & -first;
+                count2 = (count2 + 1) & (first - 1);
+            } while (len1 != 0 && len2 != 1 && (count1 | count2) < gallop);
+            if (len1 == 0 || len2 == 1) goto outer;
+
+            do {
+                count1 = len1 - gallopRight(tmp[c2], a + base1, len1, len1 - 1, comp);
+                if (count1 != 0) {
+                    dest -= count1;
+                    c1 -= count1;
+                    len1 -= count1;
+                    std::move_backward(a + c1 + 1, a + c1 + 1 + count1, a + dest + 1 + count1);
+                    if (len1 == 0) goto outer;
+                }
+                a[dest--] = std::move(tmp[c2--]);
+                if (--len2 == 1) goto outer;
+
+                count2 = len2 - gallopLeft(a[c1], tmp, len2, len2 - 1, comp);
+                if (count2 != 0) {
+                    dest -= count2;
+                    c2 -= count2;
+                    len2 -= count2;
+                    std::move(tmp + c2 + 1, tmp + c2 + 1 + count2, a + dest + 1);
+                    if (len2 <= 1) goto outer;
                 }
-                run[++last] = hi;
+                a[dest--] = std::move(a[c1--]);
+                if (--len1 == 0) goto outer;
+                gallop--;
+            } while (count1 >= MIN_GALLOP || count2 >= MIN_GALLOP);
+            if (gallop < 0) gallop = 0;
+            gallop += 2;
+        }
+
+        outer:
+        minGallop = gallop;
+        if (len2 == 1) {
+            dest -= len1;
+            c1 -= len1;
+            std::move_backward(a + c1 + 1, a + c1 + 1 + len1, a + dest + 1 + len1);
+            a[dest] = std::move(tmp[c2]);
+        } else {
+            std::move(tmp, tmp + len2, a + dest - (len2 - 1));
+        }
+    }
+
+    /**
+     * Merges the adjacent sorted runs a[base1, base2) and a[base2, end).
+     * The elements already in place at either end are skipped first, so
+     * runs which barely overlap, as sorted batches often do, are merged
+     * in O(log n) comparisons plus the moves of the overlap.
+     *
+     * @param tmp a workspace array of at least min(base2 - base1, end - base2) elements
+     * @param minGallop the galloping threshold of the sort
+     */
+    template <typename T, typename Compare>
+    void mergeAt(T *a, Index base1, Index base2, Index end, T *tmp, int &minGallop,
+                 Compare comp) {
+        // Elements of the first run not greater than the first element of the second one
+        Index k = gallopRight(a[base2], a + base1, base2 - base1, 0, comp);
+        base1 += k;
+        Index len1 = base2 - base1;
+        if (len1 == 0) return;
+
+        // Elements of the second run not less than the last element of the first one
+        Index len2 = gallopLeft(a[base2 - 1], a + base2, end - base2, end - base2 - 1, comp);
+        if (len2 == 0) return;
+
+        if (len1 <= len2) {
+            mergeLow(a, base1, len1, base2, len2, tmp, minGallop, comp);
+        } else {
+            mergeHigh(a, base1, len1, base2, len2, tmp, minGallop, comp);
+        }
+    }
+
+    template <typename T, typename Compare>
+    void extendRun(T *a, Index start, Index force, Index, Compare comp, std::true_type) {
+        insertionSort(a, start, force - 1, true, comp);
+    }
+
+    template <typename T, typename Compare>
+    void extendRun(T *a, Index start, Index force, Index k, Compare comp, std::false_type) {
+        binaryInsertionSort(a, start, force, k, comp);
+    }
+
+    /**
+     * Returns the end of the run of a[start, end) which starts at start,
+     * reversed if it is strictly descending, after extending it to
+     * MIN_RUN_LENGTH elements by insertion sort if it is shorter. Trivially
+     * copyable elements are inserted by scanning, whose comparisons are
+     * predictable, other elements by binary search, which makes fewer
+     * comparisons.
+     */
+    template <typename T, typename Compare>
+    Index nextRun(T *a, Index start, Index end, Compare comp) {
+        Index k = start + 1;
+        if (k < end && comp(a[k], a[start])) {
+            while (k < end && comp(a[k], a[k - 1])) k++;
+            std::reverse(a + start, a + k);
+        } else {
+            while (k < end && !comp(a[k], a[k - 1])) k++;
+        }
+        if (k - start < MIN_RUN_LENGTH && k < end) {
+            const Index force = std::min<Index>(end, start + MIN_RUN_LENGTH);
+            extendRun(a, start, force, k, comp,
+                      std::integral_constant<bool, std::is_trivially_copyable<T>::value>());
+            k = force;
+        }
+        return k;
+    }
+
+    /**
+     * Returns the power of the node between the adjacent runs a[start1, start2)
+     * and a[start2, end2) of an array of n elements from left, which is
+     * the depth in the perfectly balanced merge tree of the array where the
+     * midpoints of the two runs are split. Powersort merges the runs in the
+     * order of their powers, which is within O(n) of the optimal order.
+     */
+    inline int nodePower(Index left, Index n, Index start1, Index start2, Index end2) {
+        // Twice the midpoints of the runs relative to left, in units of 1 / (2 n)
+        Index x = start1 + start2 - 2 * left, y = start2 + end2 - 2 * left;
+        for (int power = 1;; power++) {
+            x <<= 1;
+            y <<= 1;
+            if ((x >= 2 * n) != (y >= 2 * n)) return power;
+            if (x >= 2 * n) {
+                x -= 2 * n;
+                y -= 2 * n;
+            }
+        }
+    }
+
+    /**
+     * Sorts the specified range of the array by merging its runs if they
+     * are few or hardly overlap, using the given workspace array slice if
+     * possible. Otherwise the range is left unsorted, possibly with some of
+     * its runs reversed, for Quicksort.
+     *
+     * The runs are merged by powersort with galloping, so there is no limit
+     * on their number, and runs shorter than MIN_RUN_LENGTH are extended by
+     * insertion sort first. The merge is stable: descending runs are
+     * reversed only if they are strictly descending.
+     *
+     * @param a the array to be sorted
+     * @param left the index of the first element, inclusive, to be sorted
+     * @param right the index of the last element, inclusive, to be sorted
+     * @param work a workspace array (slice)
+     * @param workBase origin of usable space in work array
+     * @param workLen usable size of work array
+     * @param comp the comparator
+     * @param maxRuns the maximum number of overlapping runs to be merged
+     * @return true if the range has been sorted, false if it has more than
+     *         maxRuns runs which overlap much
+     */
+    template <typename T, typename Compare>
+    bool mergeRuns(T *a, Index left, Index right, T *work, Index workBase, Index workLen,
+                   Index workLength, Compare comp, Index maxRuns = MAX_RUN_COUNT) {
+        /*
+         * Count the runs and make them ascending. Past maxRuns runs, the
+         * overlap of every two adjacent runs, the number of their elements
+         * which are out of place with respect to the other run, is found by
+         * galloping from their ends, and summed over the runs from index from.
+         * There cannot be more runs than elements, so with no limit on them
+         * the runs are only found while merging.
+         */
+        Index runs = 0, overlap = 0, from = -1;
+        for (Index k = left, last = left; k <= right && maxRuns <= right - left; k++) {
+            const Index lo = k;
+            if (k < right && comp(a[k + 1], a[k])) {
+                while (k < right && comp(a[k + 1], a[k])) k++;
+                std::reverse(a + lo, a + k + 1);
+            } else {
+                while (k < right && !comp(a[k + 1], a[k])) k++;
+            }
+
+            // Give up as soon as there are too many runs which overlap much
+            if (++runs > maxRuns && lo > left) {
+                if (from < 0) from = last;
+                overlap += gallopLeft(a[lo - 1], a + lo, k + 1 - lo, 0, comp) + (lo - last) -
+                           gallopRight(a[lo], a + last, lo - last, lo - last - 1, comp);
+                if (overlap > (k - from + 1) / MAX_RUN_OVERLAP) return false;
             }
-            if ((count & 1) != 0) {
-                for (int i = right, lo = run[count - 1]; --i >= lo; b[i + bo] = a[i + ao])
-                    ;
-                run[++last] = right;
+            last = lo;
+        }
+        if (runs == 1) return true;  // The array is already sorted
+
+        // Merge buffer for the shorter of two runs, created on the first merge if needed
+        const Index n = right - left + 1, tmpLength = n / 2;
+        T *tmp = nullptr, *allocated = nullptr;
+        if (work != nullptr && workLen >= tmpLength && workBase + tmpLength <= workLength)
+            tmp = work + workBase;
+        int minGallop = MIN_GALLOP;
+        auto merge = [&](Index base1, Index base2, Index end) {
+            // Every element is written before it is read, skip value-initialization
+            if (tmp == nullptr) tmp = allocated = new T[tmpLength];
+            mergeAt(a, base1, base2, end, tmp, minGallop, comp);
+        };
+
+        /*
+         * start[p] is the start of the pending run left of the node of
+         * power p, or -1. The pending runs are adjacent, the ones of higher
+         * power to the right, and powers never exceed the bits of an index.
+         */
+        Index start[sizeof(Index) * 8 + 1];
+        std::fill(start, start + sizeof(Index) * 8 + 1, -1);
+        const Index end = right + 1;
+        int top = 0;
+        Index start1 = left, end1 = nextRun(a, left, end, comp);
+        while (end1 < end) {
+            Index start2 = end1, end2 = nextRun(a, start2, end, comp);
+            const int power = nodePower(left, n, start1, start2, end2);
+            for (; top > power; top--) {
+                if (start[top] < 0) continue;
+                merge(start[top], start1, end1);
+                start1 = start[top];
+                start[top] = -1;
             }
-            std::swap(a, b);
-            std::swap(ao, bo);
+            start[power] = start1;
+            top = power;
+            start1 = start2;
+            end1 = end2;
+        }
+        for (; top > 0; top--) {
+            if (start[top] < 0) continue;
+            merge(start[top], start1, end);
+            start1 = start[top];
+        }
+        delete[] allocated;
+        return true;
+    }
+
+    /**
+     * Sorts the specified array stably by merging its runs, however many
+     * they are. Random arrays are split into runs of MIN_RUN_LENGTH elements
+     * sorted by insertion sort, nearly sorted ones take O(n) time.
+     *
+     * @param a the array to be sorted
+     * @param n the length of the array
+     * @param comp the comparator
+     */
+    template <typename T, typename Compare = std::less<T> >
+    inline void mergeSort(T *a, Index n, Compare comp = Compare()) {
+        if (n < 2) return;
+        mergeRuns(a, 0, n - 1, (T *) nullptr, 0, 0, 0, comp, std::numeric_limits<Index>::max());
+    }
+
+    /**
+     * Sorts the specified range of the array using the given
+     * workspace array slice if possible for merging
+     *
+     * @param a the array to be sorted
+     * @param left the index of the first element, inclusive, to be sorted
+     * @param right the index of the last element, inclusive, to be sorted
+     * @param work a workspace array (slice)
+     * @param workBase origin of usable space in work array
+     * @param workLen usable size of work array
+     * @param comp the comparator
+     */
+    template <typename T, typename Engine = ScalarQuickSort, typename Compare = std::less<T> >
+    inline void dualPivotQuickSort(T *a, Index left, Index right, T *work, Index workBase,
+                                   Index workLen, Index workLength, Compare comp = Compare()) {
+        // Sort tiny arrays directly
+        if (right - left + 1 < TinySortThreshold<T, Compare>::value) {
+            tinySort(a, left, right, true, comp);
+            return;
+        }
+
+        // Use Quicksort on small arrays and on arrays which are not highly structured
+        if (right - left < QUICKSORT_THRESHOLD ||
+            !mergeRuns(a, left, right, work, workBase, workLen, workLength, comp)) {
+            quickSort(a, left, right, comp, Engine());
         }
-        delete[] work;
     }
 
     template <typename T>
     inline void dualPivotQuickSort(T begin, T end) {
         dualPivotQuickSort(&(*begin), 0, end - begin - 1, (decltype(&(*begin))) nullptr, 0, 0, 0);
     }
+
+    template <typename T, typename Compare>
+    inline void dualPivotQuickSort(T begin, T end, Compare comp) {
+        dualPivotQuickSort(&(*begin), 0, end - begin - 1, (decltype(&(*begin))) nullptr, 0, 0, 0,
+                           comp);
+    }
 }  // namespace HybridSort
 #endif
@@ -0,0 +1,211 @@
+/**
+ * Pair Sort
+ *
+ * Copyright (c) 2019, xehoth
+ * All rights reserved.
+ *
+ * Licensed under the MIT License;
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author xehoth
+ */
+#ifndef _PAIR_SORT_HPP_
+#define _PAIR_SORT_HPP_
+#include "DualPivotQuickSort.hpp"
+#include "RadixSort.hpp"
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace HybridSort {
+
+    /**
+     * A key paired with the value stored at the same index.
+     */
+    template <typename K, typename V>
+    struct KeyValue {
+        K key;
+        V value;
+    };
+
+    /**
+     * Sorts the keys by least significant digit radix sort with digits of
+     * the given number of bits, moving the values along with them in the
+     * same scatter passes, and counting the digits in integers of type
+     * Count, which must be able to hold n.
+     *
+     * The histograms are built in one pass over the keys only, and a
+     * scatter pass is skipped if all the keys have the same digit.
+     *
+     * @param keys the keys to be sorted
+     * @param values the values to be reordered with the keys
+     * @param n the number of keys
+     * @param keyWork a workspace array of at least n keys
+     * @param valueWork a workspace array of at least n values
+     */
+    template <int BITS, typename K, typename V, typename Key, typename Count>
+    void lsdRadixSortPairsPasses(K *keys, V *values, Index n, K *keyWork, V *valueWork) {
+        using U = typename Key::Type;
+        const int RADIX = 1 << BITS;
+        const int PASSES = (sizeof(U) * 8 + BITS - 1) / BITS;
+        const unsigned int MASK = RADIX - 1;
+
+        Histograms<Count, PASSES * RADIX> histograms;
+        Count *buf = histograms.data();
+        for (Index i = 0; i < n; i++) {
+            U key = Key::encode(keys[i]);
+            for (int p = 0; p < PASSES; p++) buf[p * RADIX + ((key >> (p * BITS)) & MASK)]++;
+        }
+
+        K *fromKeys = keys, *toKeys = keyWork;
+        V *fromValues = values, *toValues = valueWork;
+        U first = Key::encode(keys[0]);
+        for (int p = 0; p < PASSES; p++) {
+            Count *cnt = &buf[p * RADIX];
+            const int shift = p * BITS;
+
+            // All the keys have the same digit, this pass changes nothing
+            if (cnt[(first >> shift) & MASK] == static_cast<Count>(n)) continue;
+
+            Count sum = 0;
+            for (int i = 0; i < RADIX; i++) {
+                Count c = cnt[i];
+                cnt[i] = sum;
+                sum += c;
+            }
+            for (Index i = 0; i < n; i++) {
+                Count j = cnt[(Key::encode(fromKeys[i]) >> shift) & MASK]++;
+                toKeys[j] = fromKeys[i];
+                toValues[j] = std::move(fromValues[i]);
+            }
+            std::swap(fromKeys, toKeys);
+            std::swap(fromValues, toValues);
+        }
+        if (fromKeys != keys) {
+            std::copy(fromKeys, fromKeys + n, keys);
+            std::move(fromValues, fromValues + n, values);
+        }
+    }
+
+    /**
+     * Sorts the keys by LSD radix sort with digits of the given number of
+     * bits, reordering the values with them. The digits are counted in
+     * 32-bit integers unless there are more keys than they can count.
+     *
+     * @param keys the keys to be sorted
+     * @param values the values to be reordered with the keys
+     * @param n the number of keys
+     */
+    template <int BITS, typename K, typename V, typename Key>
+    void lsdRadixSortPairsDigits(K *keys, V *values, Index n) {
+        std::unique_ptr<K[]> keyWork(new K[n]);
+        // No array can be this long, checking it keeps GCC from warning on new V[n]
+        if (static_cast<size_t>(n) > std::numeric_limits<Index>::max() / sizeof(V))
+            throw std::bad_alloc();
+        std::unique_ptr<V[]> valueWork(new V[n]);
+        if (static_cast<size_t>(n) <= std::numeric_limits<unsigned int>::max()) {
+            lsdRadixSortPairsPasses<BITS, K, V, Key, unsigned int>(keys, values, n, keyWork.get(),
+                                                                    valueWork.get());
+        } else {
+            lsdRadixSortPairsPasses<BITS, K, V, Key, size_t>(keys, values, n, keyWork.get(),
+                                                              valueWork.get());
+        }
+    }
+
+    /**
+     * Sorts the keys by LSD radix sort with the digit width chosen by
+     * radixDigitBits, reordering the values with them. The sort is stable.
+     * Every bucket takes two write streams, one for the keys and one for
+     * the values, so 16-bit digits would thrash the TLB and 11-bit digits
+     * are used instead, already from 2^16 keys if they are 64-bit, as they
+     * take three passes fewer than with 8-bit digits.
+     *
+     * @param keys the keys to be sorted
+     * @param values the values to be reordered with the keys
+     * @param n the number of keys
+     */
+    template <typename K, typename V, typename Key = RadixKey<K> >
+    void radixSortPairs(K *keys, V *values, Index n) {
+        const int keySize = sizeof(typename Key::Type);
+        if (n < 2) return;
+        if (radixDigitBits(n, keySize) > 8 || (keySize >= 8 && n >= (1 << 16))) {
+            lsdRadixSortPairsDigits<11, K, V, Key>(keys, values, n);
+        } else {
+            lsdRadixSortPairsDigits<8, K, V, Key>(keys, values, n);
+        }
+    }
+
+    /**
+     * Sorts the keys by Dual-Pivot Quicksort, reordering the values with
+     * them. The keys and values are zipped into pairs, so that every swap
+     * moves both, and unzipped afterwards.
+     *
+     * @param keys the keys to be sorted
+     * @param values the values to be reordered with the keys
+     * @param n the number of keys
+     * @param comp the comparator of the keys
+     */
+    template <typename K, typename V, typename Compare>
+    void quickSortPairs(K *keys, V *values, Index n, Compare comp) {
+        using P = KeyValue<K, V>;
+        if (n < 2) return;
+        std::unique_ptr<P[]> p(new P[n]);
+        for (Index i = 0; i < n; i++) {
+            p[i].key = keys[i];
+            p[i].value = std::move(values[i]);
+        }
+        dualPivotQuickSort(p.get(), p.get() + n,
+                           [comp](const P &x, const P &y) { return comp(x.key, y.key); });
+        for (Index i = 0; i < n; i++) {
+            keys[i] = p[i].key;
+            values[i] = std::move(p[i].value);
+        }
+    }
+
+    /**
+     * Moves the element at index order[i] of both ranges to index i, by
+     * following the cycles of the permutation, so no buffer is needed. The
+     * permutation is reset to the identity.
+     *
+     * @param keys the beginning of the keys
+     * @param values the beginning of the values
+     * @param order the permutation
+     * @param n the length of the permutation
+     */
+    template <typename K, typename V, typename I>
+    void permutePairs(K keys, V values, I *order, Index n) {
+        for (Index i = 0; i < n; i++) {
+            if (static_cast<Index>(order[i]) == i) continue;
+            auto key = std::move(keys[i]);
+            auto value = std::move(values[i]);
+            Index j = i;
+            for (Index k; (k = static_cast<Index>(order[j])) != i; j = k) {
+                keys[j] = std::move(keys[k]);
+                values[j] = std::move(values[k]);
+                order[j] = static_cast<I>(j);
+            }
+            keys[j] = std::move(key);
+            values[j] = std::move(value);
+            order[j] = static_cast<I>(j);
+        }
+    }
+}  // namespace HybridSort
+#endif
@@ -0,0 +1,101 @@
+/**
+ * Parallel Dual-Pivot Quicksort
+ *
+ * Copyright (c) 2019, xehoth
+ * All rights reserved.
+ *
+ * Licensed under the MIT License;
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author xehoth
+ */
+#ifndef _PARALLEL_DUAL_PIVOT_QUICK_SORT_HPP_
+#define _PARALLEL_DUAL_PIVOT_QUICK_SORT_HPP_
+#include "DualPivotQuickSort.hpp"
+#include "WorkStealingPool.hpp"
+
+namespace HybridSort {
+
+    /**
+     * If the length of a range is less than this constant, it is sorted
+     * sequentially instead of being split into parallel tasks.
+     */
+    const int PARALLEL_QUICKSORT_THRESHOLD = 8192;
+
+    /**
+     * Sorts the specified range of the array by Dual-Pivot Quicksort,
+     * spawning the parts as tasks on the pool while they are large.
+     *
+     * @param pool the pool to spawn the tasks on
+     * @param worker the index of the worker running this task
+     * @param a the array to be sorted
+     * @param left the index of the first element, inclusive, to be sorted
+     * @param right the index of the last element, inclusive, to be sorted
+     * @param leftmost indicates if this part is the leftmost in the range
+     * @param depth the number of partitioning levels left
+     */
+    template <typename T>
+    void parallelDualPivotQuickSort(WorkStealingPool &pool, int worker, T *a, Index left,
+                                    Index right, bool leftmost, int depth) {
+        while (right - left + 1 >= PARALLEL_QUICKSORT_THRESHOLD && depth > 0) {
+            QuickSortRange parts[3];
+            int count = dualPivotPartition(a, left, right, leftmost, parts);
+            --depth;
+
+            // Keep the first part on this worker, spawn the large ones and sort the rest
+            for (int i = 1; i < count; i++) {
+                QuickSortRange part = parts[i];
+                if (part.right - part.left + 1 < PARALLEL_QUICKSORT_THRESHOLD) {
+                    dualPivotQuickSort(a, part.left, part.right, part.leftmost, depth);
+                } else {
+                    pool.spawn(worker, [&pool, a, part, depth](int w) {
+                        parallelDualPivotQuickSort(pool, w, a, part.left, part.right,
+                                                   part.leftmost, depth);
+                    });
+                }
+            }
+            left = parts[0].left;
+            right = parts[0].right;
+            leftmost = parts[0].leftmost;
+        }
+        dualPivotQuickSort(a, left, right, leftmost, depth);
+    }
+
+    /**
+     * Sorts the specified array by Dual-Pivot Quicksort on a work-stealing
+     * pool of the given number of threads.
+     *
+     * @param a the array to be sorted
+     * @param n the length of the array
+     * @param threads the number of threads to use
+     */
+    template <typename T>
+    void parallelDualPivotQuickSort(T *a, Index n, int threads) {
+        if (threads <= 1 || n < PARALLEL_QUICKSORT_THRESHOLD) {
+            dualPivotQuickSort(a, 0, n - 1, true);
+            return;
+        }
+        WorkStealingPool pool(threads);
+        pool.spawn(0, [&pool, a, n](int w) {
+            parallelDualPivotQuickSort(pool, w, a, 0, n - 1, true, quickSortDepth(n));
+        });
+        pool.run();
+    }
+}  // namespace HybridSort
+#endif
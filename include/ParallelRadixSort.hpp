@@ -0,0 +1,186 @@
+/**
+ * Parallel Radix Sort
+ *
+ * Copyright (c) 2019, xehoth
+ * All rights reserved.
+ *
+ * Licensed under the MIT License;
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author xehoth
+ */
+#ifndef _PARALLEL_RADIX_SORT_HPP_
+#define _PARALLEL_RADIX_SORT_HPP_
+#include "RadixSort.hpp"
+#include "ParallelDualPivotQuickSort.hpp"
+#include <algorithm>
+#include <limits>
+#include <thread>
+#include <vector>
+
+namespace HybridSort {
+
+    /**
+     * The minimum number of elements each thread of parallel radix sort
+     * works on.
+     */
+    const int PARALLEL_RADIX_SORT_BLOCK = 1 << 16;
+
+    /**
+     * Runs f(0), f(1), ..., f(threads - 1) concurrently, f(0) on the
+     * calling thread, and waits for all of them.
+     *
+     * @param threads the number of threads
+     * @param f the function to run
+     */
+    template <typename Function>
+    void parallelFor(int threads, Function f) {
+        std::vector<std::thread> pool;
+        pool.reserve(threads - 1);
+        for (int t = 1; t < threads; t++) pool.emplace_back(f, t);
+        f(0);
+        for (auto &thread : pool) thread.join();
+    }
+
+    /**
+     * Sorts the specified array by parallel least significant digit radix
+     * sort, counting the digits in integers of type Count, which must be
+     * able to hold n.
+     *
+     * The array is split into one block per thread. Each thread counts the
+     * digits of its block, the offsets are computed by a prefix sum over
+     * digits and then threads, and each thread scatters its block to its
+     * own slice of every bucket, which keeps the sort stable.
+     *
+     * @param a the array to be sorted
+     * @param n the length of the array
+     * @param threads the number of threads to use, at least 2
+     */
+    template <typename T, typename Key, typename Count>
+    void parallelLsdRadixSortPasses(T *a, Index n, int threads) {
+        using U = typename Key::Type;
+        const int PASSES = sizeof(U);
+
+        std::vector<Index> bound(threads + 1);
+        for (int t = 0; t <= threads; t++) bound[t] = n * t / threads;
+
+        // Count all the digits of each block in one pass
+        std::vector<Count> buf(threads * PASSES * 256);
+        parallelFor(threads, [&](int t) {
+            Count *cnt = &buf[t * PASSES * 256];
+            for (Index i = bound[t]; i < bound[t + 1]; i++) {
+                U key = Key::encode(a[i]);
+                for (int p = 0; p < PASSES; p++) cnt[p * 256 + ((key >> (p << 3)) & 255)]++;
+            }
+        });
+
+        T *b = nullptr;
+        T *from = a, *to = nullptr;
+        U first = Key::encode(a[0]);
+        for (int p = 0; p < PASSES; p++) {
+            const int shift = p << 3;
+
+            // All the keys have the same digit, this pass changes nothing
+            Count same = 0;
+            for (int t = 0; t < threads; t++)
+                same += buf[(t * PASSES + p) * 256 + ((first >> shift) & 255)];
+            if (same == static_cast<Count>(n)) continue;
+
+            if (b == nullptr) {
+                b = new T[n];
+                to = b;
+            } else {
+                // The blocks have been permuted by the previous pass, count them again
+                parallelFor(threads, [&](int t) {
+                    Count *cnt = &buf[(t * PASSES + p) * 256];
+                    std::fill(cnt, cnt + 256, 0);
+                    for (Index i = bound[t]; i < bound[t + 1]; i++)
+                        cnt[(Key::encode(from[i]) >> shift) & 255]++;
+                });
+            }
+            Count sum = 0;
+            for (int d = 0; d < 256; d++) {
+                for (int t = 0; t < threads; t++) {
+                    Count &c = buf[(t * PASSES + p) * 256 + d];
+                    Count count = c;
+                    c = sum;
+                    sum += count;
+                }
+            }
+            parallelFor(threads, [&](int t) {
+                Count *cnt = &buf[(t * PASSES + p) * 256];
+                for (Index i = bound[t]; i < bound[t + 1]; i++)
+                    to[cnt[(Key::encode(from[i]) >> shift) & 255]++] = from[i];
+            });
+            std::swap(from, to);
+        }
+        if (from != a) {
+            parallelFor(threads, [&](int t) {
+                std::copy(from + bound[t], from + bound[t + 1], a + bound[t]);
+            });
+        }
+        delete[] b;
+    }
+
+    /**
+     * Sorts the specified array by parallel least significant digit radix
+     * sort. The digits are counted in 32-bit integers unless the array is
+     * longer than they can count.
+     *
+     * @param a the array to be sorted
+     * @param n the length of the array
+     * @param threads the maximum number of threads to use
+     */
+    template <typename T, typename Key = RadixKey<T> >
+    void parallelLsdRadixSort(T *a, Index n, int threads) {
+        threads = static_cast<int>(std::min<Index>(threads, n / PARALLEL_RADIX_SORT_BLOCK));
+        if (threads <= 1) {
+            lsdRadixSort<T, Key>(a, n);
+        } else if (static_cast<size_t>(n) <= std::numeric_limits<unsigned int>::max()) {
+            parallelLsdRadixSortPasses<T, Key, unsigned int>(a, n, threads);
+        } else {
+            parallelLsdRadixSortPasses<T, Key, size_t>(a, n, threads);
+        }
+    }
+
+    template <typename T>
+    inline void parallelRadixSort(T *a, Index n, int threads, std::true_type) {
+        parallelLsdRadixSort(a, n, threads);
+    }
+
+    template <typename T>
+    inline void parallelRadixSort(T *a, Index n, int threads, std::false_type) {
+        parallelDualPivotQuickSort(a, n, threads);
+    }
+
+    /**
+     * Sorts the specified array with the given number of threads,
+     * by parallel Dual-Pivot Quicksort if the type has no radix key.
+     *
+     * @param a the array to be sorted
+     * @param n the length of the array
+     * @param threads the maximum number of threads to use
+     */
+    template <typename T>
+    void parallelRadixSort(T *a, Index n, int threads) {
+        parallelRadixSort(a, n, threads, std::integral_constant<bool, HasRadixKey<T>::value>());
+    }
+
+}  // namespace HybridSort
+#endif
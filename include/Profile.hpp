@@ -0,0 +1,140 @@
+/**
+ * Threshold Profile
+ *
+ * Copyright (c) 2019, xehoth
+ * All rights reserved.
+ *
+ * Licensed under the MIT License;
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author xehoth
+ */
+#ifndef _PROFILE_HPP_
+#define _PROFILE_HPP_
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+/*
+ * The thresholds below were measured on one machine. Run tuneThresholds on
+ * the target machine to measure them there, and either compile them in by
+ * defining HYBRID_SORT_PROFILE_HEADER as the header it writes, e.g.
+ * -DHYBRID_SORT_PROFILE_HEADER='"HybridSortProfile.hpp"', or point the
+ * HYBRID_SORT_PROFILE environment variable to the profile it writes, which
+ * overrides the radix sort thresholds when the program first sorts.
+ */
+#ifdef HYBRID_SORT_PROFILE_HEADER
+#include HYBRID_SORT_PROFILE_HEADER
+#endif
+
+#ifndef HYBRID_SORT_MAX_RUN_COUNT
+#define HYBRID_SORT_MAX_RUN_COUNT 67
+#endif
+
+#ifndef HYBRID_SORT_QUICKSORT_THRESHOLD
+#define HYBRID_SORT_QUICKSORT_THRESHOLD 286
+#endif
+
+#ifndef HYBRID_SORT_INSERTION_SORT_THRESHOLD
+#define HYBRID_SORT_INSERTION_SORT_THRESHOLD 47
+#endif
+
+#ifndef HYBRID_SORT_RADIX_SORT_THRESHOLD_8
+#define HYBRID_SORT_RADIX_SORT_THRESHOLD_8 1024
+#endif
+
+#ifndef HYBRID_SORT_RADIX_SORT_THRESHOLD_16
+#define HYBRID_SORT_RADIX_SORT_THRESHOLD_16 1048576
+#endif
+
+#ifndef HYBRID_SORT_RADIX_SORT_THRESHOLD_32
+#define HYBRID_SORT_RADIX_SORT_THRESHOLD_32 2097152
+#endif
+
+#ifndef HYBRID_SORT_RADIX_SORT_THRESHOLD_64
+#define HYBRID_SORT_RADIX_SORT_THRESHOLD_64 4194304
+#endif
+
+namespace HybridSort {
+
+    /**
+     * The thresholds which can be changed at runtime.
+     */
+    struct Profile {
+        /**
+         * If the length of an array of keys of 8 << i bits to be sorted is
+         * greater than radixSortThreshold[i], radix sort is used in
+         * preference to Dual-Pivot Quicksort.
+         */
+        long long radixSortThreshold[4];
+    };
+
+    /**
+     * Reads the thresholds of the profile file into the profile. The file
+     * has one "name value" pair per line, as written by tuneThresholds,
+     * names which are unknown or compiled in are skipped.
+     *
+     * @param path the path of the profile file
+     * @param profile the profile to update
+     * @return false if the file cannot be read
+     */
+    inline bool readProfile(const char *path, Profile &profile) {
+        std::ifstream in(path);
+        if (!in) return false;
+        std::string name;
+        long long value;
+        while (in >> name >> value) {
+            for (int i = 0; i < 4; i++) {
+                if (name == "radix_sort_threshold_" + std::to_string(8 << i))
+                    profile.radixSortThreshold[i] = value;
+            }
+        }
+        return true;
+    }
+
+    inline Profile startupProfile() {
+        Profile profile = {{HYBRID_SORT_RADIX_SORT_THRESHOLD_8, HYBRID_SORT_RADIX_SORT_THRESHOLD_16,
+                            HYBRID_SORT_RADIX_SORT_THRESHOLD_32,
+                            HYBRID_SORT_RADIX_SORT_THRESHOLD_64}};
+        const char *path = std::getenv("HYBRID_SORT_PROFILE");
+        if (path != nullptr) readProfile(path, profile);
+        return profile;
+    }
+
+    /**
+     * The thresholds in use, the compiled in ones overridden by the file
+     * named by the HYBRID_SORT_PROFILE environment variable, if any.
+     */
+    inline Profile &profile() {
+        static Profile profile = startupProfile();
+        return profile;
+    }
+
+    /**
+     * Loads the thresholds of the profile file. It must not be called
+     * while other threads are sorting.
+     *
+     * @param path the path of the profile file
+     * @return false if the file cannot be read
+     */
+    inline bool loadProfile(const char *path) {
+        return readProfile(path, profile());
+    }
+}  // namespace HybridSort
+#endif
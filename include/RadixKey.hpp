@@ -0,0 +1,325 @@
+/**
+ * Radix Key
+ *
+ * Copyright (c) 2019, xehoth
+ * All rights reserved.
+ *
+ * Licensed under the MIT License;
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author xehoth
+ */
+#ifndef _RADIX_KEY_HPP_
+#define _RADIX_KEY_HPP_
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace HybridSort {
+
+    /**
+     * Checks if T is a primitive key, an arithmetic or enumeration type,
+     * whose elements are cheap to copy and compare.
+     */
+    template <typename T>
+    struct IsPrimitiveKey
+        : std::integral_constant<bool, std::is_arithmetic<T>::value || std::is_enum<T>::value> {};
+
+    /**
+     * The arithmetic type which has the same representation and order as
+     * T, the underlying type of an enumeration and T itself otherwise.
+     */
+    template <typename T, bool = std::is_enum<T>::value>
+    struct KeyType {
+        using type = T;
+    };
+
+    template <typename T>
+    struct KeyType<T, true> {
+        using type = typename std::underlying_type<T>::type;
+    };
+
+    /**
+     * Maps a key to an unsigned integer with the same order, so that
+     * the key can be sorted digit by digit.
+     *
+     * Specializations provide the unsigned type as Type and the
+     * order-preserving transform as encode, integral and floating-point
+     * keys also provide its inverse as decode. Every integral type but
+     * bool and every enumeration type has one.
+     */
+    template <typename T, typename = void>
+    struct RadixKey;
+
+    template <typename T>
+    struct VoidType {
+        using type = void;
+    };
+
+    /**
+     * Checks if the type has a radix key, i.e. can be sorted by radix sort.
+     */
+    template <typename T, typename = void>
+    struct HasRadixKey : std::false_type {};
+
+    template <typename T>
+    struct HasRadixKey<T, typename VoidType<typename RadixKey<T>::Type>::type> : std::true_type {};
+
+    /**
+     * Radix key of an integral type, signed keys are mapped to unsigned
+     * ones by flipping the sign bit.
+     */
+    template <typename T, typename U>
+    struct IntegralRadixKey {
+        using Type = U;
+
+        static Type encode(T x) {
+            return std::is_signed<typename KeyType<T>::type>::value
+                       ? static_cast<U>(static_cast<U>(x) ^ (U(1) << (sizeof(U) * 8 - 1)))
+                       : static_cast<U>(x);
+        }
+
+        static T decode(Type u) {
+            using K = typename KeyType<T>::type;
+            return static_cast<T>(static_cast<K>(
+                std::is_signed<K>::value ? static_cast<U>(u ^ (U(1) << (sizeof(U) * 8 - 1))) : u));
+        }
+    };
+
+    template <typename T>
+    struct RadixKey<T, typename std::enable_if<(std::is_integral<T>::value &&
+                                                !std::is_same<T, bool>::value) ||
+                                               std::is_enum<T>::value>::type>
+        : IntegralRadixKey<T, typename std::make_unsigned<typename KeyType<T>::type>::type> {};
+
+    /**
+     * Radix key of an IEEE 754 floating-point type. The sign bit is flipped
+     * for positive values and all the bits are flipped for negative ones,
+     * which defines a total order on the bit patterns:
+     *
+     *   -NaN < -inf < ... < -0.0 < +0.0 < ... < +inf < +NaN
+     */
+    template <typename T, typename U>
+    struct FloatingRadixKey {
+        using Type = U;
+
+        static Type encode(T x) {
+            U u;
+            memcpy(&u, &x, sizeof(U));
+            const U sign = U(1) << (sizeof(U) * 8 - 1);
+            return u ^ (static_cast<U>(-(u >> (sizeof(U) * 8 - 1))) | sign);
+        }
+
+        static T decode(Type u) {
+            const U sign = U(1) << (sizeof(U) * 8 - 1);
+            u ^= static_cast<U>((u >> (sizeof(U) * 8 - 1)) - 1) | sign;
+            T x;
+            memcpy(&x, &u, sizeof(U));
+            return x;
+        }
+    };
+
+    template <>
+    struct RadixKey<float> : FloatingRadixKey<float, unsigned int> {};
+
+    template <>
+    struct RadixKey<double> : FloatingRadixKey<double, unsigned long long> {};
+
+    /**
+     * Radix key under which radix sort is stable with respect to operator<,
+     * which doesn't tell -0.0 from +0.0. Negative zero has the key of
+     * positive zero, so zeros keep their order, other keys are the same.
+     */
+    template <typename T, bool = std::is_floating_point<T>::value>
+    struct StableRadixKey : RadixKey<T> {};
+
+    template <typename T>
+    struct StableRadixKey<T, true> : RadixKey<T> {
+        static typename RadixKey<T>::Type encode(T x) {
+            return RadixKey<T>::encode(x == T(0) ? T(0) : x);
+        }
+    };
+
+    /**
+     * Radix key in the reverse order of the given one, its digits are
+     * complemented, so radix sort by it emits descending order directly.
+     */
+    template <typename Key>
+    struct DescendingRadixKey {
+        using Type = typename Key::Type;
+
+        template <typename T>
+        static Type encode(T x) {
+            return static_cast<Type>(~Key::encode(x));
+        }
+
+        template <typename K = Key>
+        static auto decode(Type u) -> decltype(K::decode(u)) {
+            return K::decode(static_cast<Type>(~u));
+        }
+    };
+
+    /**
+     * Radix key of the field I of a pair or tuple. Floating-point fields
+     * take the stable radix key, so that -0.0 and +0.0, which operator<
+     * doesn't tell apart, leave the order to the following fields.
+     */
+    template <typename T, size_t I>
+    struct FieldRadixKey {
+        using Key = StableRadixKey<typename std::tuple_element<I, T>::type>;
+        using Type = typename Key::Type;
+
+        static Type encode(const T &x) {
+            return Key::encode(std::get<I>(x));
+        }
+    };
+
+    /**
+     * Checks if the first N fields of a pair or tuple have radix keys.
+     */
+    template <typename T, size_t N = std::tuple_size<T>::value>
+    struct FieldsHaveRadixKeys
+        : std::integral_constant<bool,
+                                 HasRadixKey<typename std::tuple_element<N - 1, T>::type>::value &&
+                                     FieldsHaveRadixKeys<T, N - 1>::value> {};
+
+    template <typename T>
+    struct FieldsHaveRadixKeys<T, 0> : std::true_type {};
+
+    /**
+     * Checks if T is a composite key, a pair or a non-empty tuple of fields
+     * which have radix keys, ordered lexicographically by operator<.
+     */
+    template <typename T>
+    struct IsCompositeKey : std::false_type {};
+
+    template <typename A, typename B>
+    struct IsCompositeKey<std::pair<A, B> > : FieldsHaveRadixKeys<std::pair<A, B> > {};
+
+    template <typename T, typename... Ts>
+    struct IsCompositeKey<std::tuple<T, Ts...> > : FieldsHaveRadixKeys<std::tuple<T, Ts...> > {};
+
+    /**
+     * The total size in bytes of the radix keys of the first N fields of
+     * a composite key.
+     */
+    template <typename T, size_t N = std::tuple_size<T>::value>
+    struct FieldsKeySize
+        : std::integral_constant<size_t, sizeof(typename FieldRadixKey<T, N - 1>::Type) +
+                                             FieldsKeySize<T, N - 1>::value> {};
+
+    template <typename T>
+    struct FieldsKeySize<T, 0> : std::integral_constant<size_t, 0> {};
+
+    /**
+     * The size in bytes of the radix keys of all the fields of T if it is
+     * a composite key, and 0 otherwise.
+     */
+    template <typename T, bool = IsCompositeKey<T>::value>
+    struct CompositeKeySize : std::integral_constant<size_t, 0> {};
+
+    template <typename T>
+    struct CompositeKeySize<T, true> : FieldsKeySize<T> {};
+
+    /**
+     * The smallest unsigned integral type of at least the given size in
+     * bytes, which is at most 8.
+     */
+    template <size_t SIZE>
+    struct UnsignedOfSize {
+        using type = typename std::conditional<
+            SIZE <= 1, std::uint8_t,
+            typename std::conditional<
+                SIZE <= 2, std::uint16_t,
+                typename std::conditional<SIZE <= 4, std::uint32_t, std::uint64_t>::type>::type>::
+            type;
+    };
+
+    /**
+     * Appends the radix keys of the fields from I on to the packed key u.
+     */
+    template <typename T, typename U, size_t I = 1, size_t N = std::tuple_size<T>::value>
+    struct PackFields {
+        static U pack(const T &x, U u) {
+            using Key = FieldRadixKey<T, I>;
+            u = static_cast<U>((u << (sizeof(typename Key::Type) * 8)) | Key::encode(x));
+            return PackFields<T, U, I + 1, N>::pack(x, u);
+        }
+    };
+
+    template <typename T, typename U, size_t N>
+    struct PackFields<T, U, N, N> {
+        static U pack(const T &, U u) {
+            return u;
+        }
+    };
+
+    /**
+     * Radix key of the first N fields of a composite key, which must fit
+     * in 64 bits together. The radix keys of the fields are packed from
+     * the first field in the most significant bits to the last one in the
+     * least significant, so the packed keys are in lexicographic order,
+     * and radix sort skips the passes over digits all the keys share, e.g.
+     * the padding of a 24-bit key in 32 bits.
+     */
+    template <typename T, size_t N = std::tuple_size<T>::value>
+    struct PackedRadixKey {
+        using Type = typename UnsignedOfSize<FieldsKeySize<T, N>::value>::type;
+
+        static Type encode(const T &x) {
+            return PackFields<T, Type, 1, N>::pack(
+                x, static_cast<Type>(FieldRadixKey<T, 0>::encode(x)));
+        }
+    };
+
+    /**
+     * The number of the leading fields of a composite key whose radix keys
+     * fit in 64 bits together.
+     */
+    template <typename T, size_t N = std::tuple_size<T>::value,
+              bool = (FieldsKeySize<T, N>::value <= 8)>
+    struct PrefixFields : PrefixFields<T, N - 1> {};
+
+    template <typename T, size_t N>
+    struct PrefixFields<T, N, true> : std::integral_constant<size_t, N> {};
+
+    /**
+     * Radix key of the leading fields of a composite key which fit in 64
+     * bits, all its fields if they fit. Keys of equal prefix keys must be
+     * ordered by their other fields afterwards.
+     */
+    template <typename T>
+    struct PrefixRadixKey : PackedRadixKey<T, PrefixFields<T>::value> {};
+
+    /**
+     * Checks if the radix keys of the fields of T can be packed into one
+     * 64-bit radix key.
+     */
+    template <typename T>
+    struct IsPackedKey
+        : std::integral_constant<bool, CompositeKeySize<T>::value != 0 &&
+                                           CompositeKeySize<T>::value <= 8> {};
+
+    template <typename T>
+    struct RadixKey<T, typename std::enable_if<IsPackedKey<T>::value>::type> : PackedRadixKey<T> {};
+}  // namespace HybridSort
+#endif
@@ -27,92 +27,563 @@
  */
 #ifndef _RADIX_SORT_HPP_
 #define _RADIX_SORT_HPP_
+#include "DualPivotQuickSort.hpp"
+#include "RadixKey.hpp"
 #include <cstring>
 #include <algorithm>
+#include <functional>
+#include <limits>
+#include <type_traits>
+#include <vector>
 
 namespace HybridSort {
-    template <typename T>
-    void radixSort(T *a, int n) {
-        std::sort(a, a + n);
-    }
 
-    template <>
-    void radixSort<unsigned int>(unsigned int *a, int n) {
-        using T = unsigned int;
-        T *b = new T[n];
+    /**
+     * If the length of a bucket in American flag sort is less than this
+     * constant, Quicksort is used in preference to radix sort.
+     */
+    const int AMERICAN_FLAG_SORT_THRESHOLD = 64;
+
+    /**
+     * The maximum size in bytes of the scratch buffer of LSD radix sort,
+     * larger arrays are sorted in place by American flag sort.
+     */
+    const size_t MAX_RADIX_SORT_BUFFER_SIZE = 1 << 30;
+
+    /**
+     * The maximum size in bytes of the digit histograms of LSD radix sort
+     * which are kept on the stack, larger ones are allocated on the heap.
+     * It is kept small, as the sort may run on threads with small stacks.
+     */
+    const size_t MAX_STACK_HISTOGRAM_SIZE = 8 << 10;
+
+    /**
+     * The zeroed digit histograms of LSD radix sort, kept on the stack for
+     * 8-bit digits counted in 32-bit integers, so that sorting short arrays
+     * repeatedly doesn't allocate, and on the heap for wider digits, which
+     * are only used for arrays long enough to amortize the allocation.
+     */
+    template <typename Count, size_t SIZE,
+              bool = SIZE * sizeof(Count) <= MAX_STACK_HISTOGRAM_SIZE>
+    struct Histograms {
+        Count buf[SIZE];
+
+        Histograms() { std::fill_n(buf, SIZE, 0); }
+
+        Count *data() { return buf; }
+    };
+
+    template <typename Count, size_t SIZE>
+    struct Histograms<Count, SIZE, false> {
+        std::vector<Count> buf;
 
-        static unsigned int buf[256];
+        Histograms() : buf(SIZE) {}
 
-        memset(buf, 0, sizeof(unsigned int) * 256);
-        for (int i = 0; i < n; i++) buf[a[i] & 255]++;
-        for (int i = 1; i < 256; i++) buf[i] += buf[i - 1];
-        for (int i = n - 1; i >= 0; i--) b[--buf[a[i] & 255]] = a[i];
+        Count *data() { return buf.data(); }
+    };
 
-        memset(buf, 0, sizeof(unsigned int) * 256);
-        for (int i = 0; i < n; i++) buf[(b[i] >> 8) & 255]++;
-        for (int i = 1; i < 256; i++) buf[i] += buf[i - 1];
-        for (int i = n - 1; i >= 0; i--) a[--buf[(b[i] >> 8) & 255]] = b[i];
+    /**
+     * Sorts the specified array by least significant digit radix sort
+     * with digits of the given number of bits, counting the digits in
+     * integers of type Count, which must be able to hold n.
+     *
+     * The histograms of all the digits are built in one pass over the array,
+     * and a scatter pass is skipped if all the keys have the same digit.
+     *
+     * @param a the array to be sorted
+     * @param n the length of the array
+     * @param work a workspace array of at least n elements,
+     *             or nullptr to create one if needed
+     */
+    template <int BITS, typename T, typename Key, typename Count>
+    void lsdRadixSortPasses(T *a, Index n, T *work) {
+        using U = typename Key::Type;
+        const int RADIX = 1 << BITS;
+        const int PASSES = (sizeof(U) * 8 + BITS - 1) / BITS;
+        const unsigned int MASK = RADIX - 1;
+        if (n < 2) return;
 
-        memset(buf, 0, sizeof(unsigned int) * 256);
-        for (int i = 0; i < n; i++) buf[(a[i] >> 16) & 255]++;
-        for (int i = 1; i < 256; i++) buf[i] += buf[i - 1];
-        for (int i = n - 1; i >= 0; i--) b[--buf[(a[i] >> 16) & 255]] = a[i];
+        Histograms<Count, PASSES * RADIX> histograms;
+        Count *buf = histograms.data();
+        for (Index i = 0; i < n; i++) {
+            U key = Key::encode(a[i]);
+            for (int p = 0; p < PASSES; p++) buf[p * RADIX + ((key >> (p * BITS)) & MASK)]++;
+        }
 
-        memset(buf, 0, sizeof(unsigned int) * 256);
-        for (int i = 0; i < n; i++) buf[(b[i] >> 24) & 255]++;
-        for (int i = 1; i < 256; i++) buf[i] += buf[i - 1];
-        for (int i = n - 1; i >= 0; i--) a[--buf[(b[i] >> 24) & 255]] = b[i];
+        T *b = nullptr;
+        T *from = a, *to = nullptr;
+        U first = Key::encode(a[0]);
+        for (int p = 0; p < PASSES; p++) {
+            Count *cnt = &buf[p * RADIX];
+            const int shift = p * BITS;
+
+            // All the keys have the same digit, this pass changes nothing
+            if (cnt[(first >> shift) & MASK] == static_cast<Count>(n)) continue;
+
+            if (to == nullptr) to = work != nullptr ? work : (b = new T[n]);
+            Count sum = 0;
+            for (int i = 0; i < RADIX; i++) {
+                Count c = cnt[i];
+                cnt[i] = sum;
+                sum += c;
+            }
+            for (Index i = 0; i < n; i++) {
+                to[cnt[(Key::encode(from[i]) >> shift) & MASK]++] = from[i];
+            }
+            std::swap(from, to);
+        }
+        if (from != a) std::copy(from, from + n, a);
         delete[] b;
     }
 
-    template <>
-    void radixSort<unsigned short>(unsigned short *a, int n) {
-        using T = unsigned short;
-        T *b = new T[n];
+    /**
+     * Sorts the specified array by least significant digit radix sort
+     * with digits of the given number of bits. The digits are counted
+     * in 32-bit integers unless the array is longer than they can count.
+     *
+     * @param a the array to be sorted
+     * @param n the length of the array
+     * @param work a workspace array of at least n elements,
+     *             or nullptr to create one if needed
+     */
+    template <int BITS, typename T, typename Key = RadixKey<T> >
+    void lsdRadixSortDigits(T *a, Index n, T *work = nullptr) {
+        if (static_cast<size_t>(n) <= std::numeric_limits<unsigned int>::max()) {
+            lsdRadixSortPasses<BITS, T, Key, unsigned int>(a, n, work);
+        } else {
+            lsdRadixSortPasses<BITS, T, Key, size_t>(a, n, work);
+        }
+    }
 
-        static unsigned int buf[256];
+    /**
+     * Sorts the specified array by least significant digit radix sort
+     * with 8-bit digits.
+     *
+     * @param a the array to be sorted
+     * @param n the length of the array
+     * @param work a workspace array of at least n elements,
+     *             or nullptr to create one if needed
+     */
+    template <typename T, typename Key = RadixKey<T> >
+    void lsdRadixSort(T *a, Index n, T *work = nullptr) {
+        lsdRadixSortDigits<8, T, Key>(a, n, work);
+    }
 
-        memset(buf, 0, sizeof(unsigned int) * 256);
-        for (int i = 0; i < n; i++) buf[a[i] & 255]++;
-        for (int i = 1; i < 256; i++) buf[i] += buf[i - 1];
-        for (int i = n - 1; i >= 0; i--) b[--buf[a[i] & 255]] = a[i];
+    /**
+     * Sorts the specified array by in-place most significant digit radix
+     * sort (American flag sort), starting from the given digit.
+     *
+     * Elements are moved into their buckets by following permutation
+     * cycles, so no scratch buffer is needed, and each bucket is sorted
+     * recursively on the next digit.
+     *
+     * @param a the array to be sorted
+     * @param n the length of the array
+     * @param shift the bit offset of the current digit
+     * @param comp the comparator which orders the elements as Key does
+     */
+    template <typename T, typename Key, typename Compare = std::less<T> >
+    void americanFlagSort(T *a, Index n, int shift, Compare comp = Compare()) {
+        using U = typename Key::Type;
+        Index cnt[256], head[256], tail[256];
+        for (;;) {
+            // Use Quicksort on small buckets
+            if (n < AMERICAN_FLAG_SORT_THRESHOLD) {
+                dualPivotQuickSort(a, 0, n - 1, true, quickSortDepth(n), comp);
+                return;
+            }
 
-        memset(buf, 0, sizeof(unsigned int) * 256);
-        for (int i = 0; i < n; i++) buf[(b[i] >> 8) & 255]++;
-        for (int i = 1; i < 256; i++) buf[i] += buf[i - 1];
-        for (int i = n - 1; i >= 0; i--) a[--buf[(b[i] >> 8) & 255]] = b[i];
-        delete[] b;
+            memset(cnt, 0, sizeof(cnt));
+            for (Index i = 0; i < n; i++) cnt[(Key::encode(a[i]) >> shift) & 255]++;
+
+            // All the keys have the same digit, go on with the next one
+            U first = Key::encode(a[0]);
+            if (cnt[(first >> shift) & 255] != n) break;
+            if (shift == 0) return;
+            shift -= 8;
+        }
+
+        Index sum = 0;
+        for (int i = 0; i < 256; i++) {
+            head[i] = sum;
+            sum += cnt[i];
+            tail[i] = sum;
+        }
+
+        // Permute the elements into their buckets cycle by cycle
+        for (int d = 0; d < 256; d++) {
+            while (head[d] < tail[d]) {
+                T v = a[head[d]];
+                int k = (Key::encode(v) >> shift) & 255;
+                while (k != d) {
+                    std::swap(v, a[head[k]++]);
+                    k = (Key::encode(v) >> shift) & 255;
+                }
+                a[head[d]++] = v;
+            }
+        }
+        if (shift == 0) return;
+
+        Index begin = 0;
+        for (int d = 0; d < 256; begin += cnt[d++]) {
+            if (cnt[d] > 1) americanFlagSort<T, Key>(a + begin, cnt[d], shift - 8, comp);
+        }
     }
 
-    template <>
-    void radixSort<unsigned char>(unsigned char *a, int n) {
-        using T = unsigned char;
-        T *b = new T[n];
+    /**
+     * Sorts the specified array by American flag sort, which needs
+     * O(1) extra memory per element unlike LSD radix sort.
+     *
+     * @param a the array to be sorted
+     * @param n the length of the array
+     * @param comp the comparator which orders the elements as Key does
+     */
+    template <typename T, typename Key = RadixKey<T>, typename Compare = std::less<T> >
+    void americanFlagSort(T *a, Index n, Compare comp = Compare()) {
+        if (n < 2) return;
+        americanFlagSort<T, Key>(a, n, (sizeof(typename Key::Type) - 1) << 3, comp);
+    }
 
-        static unsigned int buf[256];
+    /**
+     * If the length of a bucket in radix select is less than this constant,
+     * Dual-Pivot Quicksort selection is used in preference to radix select.
+     */
+    const int RADIX_SELECT_THRESHOLD = 1024;
 
-        memset(buf, 0, sizeof(unsigned int) * 256);
-        for (int i = 0; i < n; i++) buf[a[i] & 255]++;
-        for (int i = 1; i < 256; i++) buf[i] += buf[i - 1];
-        for (int i = n - 1; i >= 0; i--) b[--buf[a[i] & 255]] = a[i];
-        memcpy(a, b, sizeof(T) * n);
-        delete[] b;
+    /**
+     * Returns the shift of the 8 bits down from the highest set bit of the
+     * key, or 0 if it is one of the lowest 8 bits.
+     */
+    template <typename U>
+    inline int topDigitShift(U key) {
+        int top = sizeof(U) * 8 - 1;
+        while (top > 0 && (key >> top) == 0) top--;
+        return std::max(top - 7, 0);
+    }
+
+    /**
+     * Rearranges the specified array so that a[k] is the element which
+     * would be there if the array was sorted, no element before it is
+     * greater and no element after it is less.
+     *
+     * The keys are counted by 8 bits at a time from the highest bit in which
+     * they differ, and the bucket of k is split off by moving the keys of
+     * smaller digits before it and the keys of greater digits after it. Only
+     * that bucket is selected from on the next bits. The bits which all the
+     * keys share, as the high bits of small keys in wide types, are guessed
+     * from a sample, so they usually take no counting pass.
+     *
+     * @param a the array
+     * @param n the length of the array
+     * @param k the index of the element to be selected
+     * @param comp the comparator which orders the elements as Key does
+     */
+    template <typename T, typename Key = RadixKey<T>, typename Compare = std::less<T> >
+    void radixSelect(T *a, Index n, Index k, Compare comp = Compare()) {
+        using U = typename Key::Type;
+        const int SAMPLES = 64;
+        const U sample = Key::encode(a[0]);
+        U diff = 0;
+        for (Index i = 0; i < n; i += n / SAMPLES + 1) diff |= Key::encode(a[i]) ^ sample;
+
+        Index cnt[256];
+        Index lo = 0, hi = n;
+        for (int shift = topDigitShift(diff); hi - lo >= RADIX_SELECT_THRESHOLD;) {
+            memset(cnt, 0, sizeof(cnt));
+            const U first = Key::encode(a[lo]);
+            diff = 0;
+            for (Index i = lo; i < hi; i++) {
+                const U key = Key::encode(a[i]);
+                cnt[(key >> shift) & 255]++;
+                diff |= key ^ first;
+            }
+
+            // All the keys are equal
+            if (diff == 0) return;
+
+            // The digit misses the highest bit in which the keys differ, count them again
+            if ((diff >> shift >> 8) != 0 || (diff >> shift) == 0) {
+                shift = topDigitShift(diff);
+                continue;
+            }
+
+            unsigned int d = 0;
+            Index start = lo;
+            while (start + cnt[d] <= k) start += cnt[d++];
+            if (start > lo) {
+                blockPartition(a, lo, hi, [shift, d](const T &x) {
+                    return ((Key::encode(x) >> shift) & 255) < d;
+                });
+            }
+            if (start + cnt[d] < hi) {
+                blockPartition(a, start, hi, [shift, d](const T &x) {
+                    return ((Key::encode(x) >> shift) & 255) == d;
+                });
+            }
+            lo = start;
+            hi = start + cnt[d];
+
+            // All the keys of the bucket are equal
+            if (shift == 0) return;
+            shift = std::max(shift - 8, 0);
+        }
+        dualPivotSelect(a, lo, hi - 1, k, lo == 0, comp);
     }
 
-    template <>
-    void radixSort<char>(char *a, int n) {
-        radixSort((unsigned char *)a, n);
+    /**
+     * If the length of an array of integral keys to be sorted is at least
+     * this constant, counting sort is used if their range is narrow enough.
+     */
+    const int COUNTING_SORT_THRESHOLD = 256;
+
+    /**
+     * The maximum number of distinct keys counted by counting sort, whose
+     * counters must stay in the L2 cache.
+     */
+    const int MAX_COUNTING_SORT_RANGE = 65536;
+
+    /**
+     * Sorts the specified array of integral keys by counting sort. The keys
+     * are counted in one pass, and the sorted array is written back run by
+     * run from the counts, so no scratch buffer is needed. Equal integers
+     * are identical, so rewriting them is the same as moving them.
+     *
+     * @param a the array to be sorted
+     * @param n the length of the array
+     * @param lo the least radix key of the array
+     * @param range the number of radix keys from lo on, all of the keys
+     *              of the array among them
+     * @param cnt the counters, which are resized to range and zeroed
+     */
+    template <typename T, typename Key = RadixKey<T> >
+    void countingSort(T *a, Index n, typename Key::Type lo, Index range, std::vector<Index> &cnt) {
+        using U = typename Key::Type;
+        cnt.assign(range, 0);
+        for (Index i = 0; i < n; i++) cnt[static_cast<U>(Key::encode(a[i]) - lo)]++;
+        T *p = a;
+        for (Index d = 0; d < range; d++) {
+            if (cnt[d] != 0) p = std::fill_n(p, cnt[d], Key::decode(static_cast<U>(lo + d)));
+        }
     }
 
-    template <>
-    void radixSort<short>(short *a, int n) {
-        radixSort((unsigned short *)a, n);
+    template <typename T, typename Key>
+    bool narrowRangeSort(T *a, Index n, std::vector<Index> &cnt, std::true_type) {
+        using U = typename Key::Type;
+        const int SAMPLES = 64;
+        if (n < COUNTING_SORT_THRESHOLD) return false;
+
+        // Counting every 8-bit key is cheaper than finding their range
+        if (sizeof(U) == 1) {
+            countingSort<T, Key>(a, n, 0, 256, cnt);
+            return true;
+        }
+
+        // Scanning the counters of up to 4 keys per element still beats sorting them
+        const Index limit = std::min<Index>(4 * n, MAX_COUNTING_SORT_RANGE);
+
+        // A sample spans at most the range of the array, so wide ranges fail early
+        U lo = Key::encode(a[0]), hi = lo;
+        for (Index i = 0; i < n; i += n / SAMPLES + 1) {
+            const U key = Key::encode(a[i]);
+            lo = std::min(lo, key);
+            hi = std::max(hi, key);
+        }
+        if (static_cast<U>(hi - lo) >= static_cast<unsigned long long>(limit)) return false;
+
+        for (Index i = 0; i < n; i++) {
+            const U key = Key::encode(a[i]);
+            lo = std::min(lo, key);
+            hi = std::max(hi, key);
+        }
+        if (static_cast<U>(hi - lo) >= static_cast<unsigned long long>(limit)) return false;
+        countingSort<T, Key>(a, n, lo, static_cast<Index>(static_cast<U>(hi - lo)) + 1, cnt);
+        return true;
+    }
+
+    template <typename T, typename Key>
+    inline bool narrowRangeSort(T *, Index, std::vector<Index> &, std::false_type) {
+        return false;
     }
 
-    template <>
-    void radixSort<int>(int *a, int n) {
-        radixSort((unsigned int *)a, n);
+    /**
+     * Sorts the specified array by counting sort if it is long enough and
+     * its keys are integers in a range narrower than both four times its
+     * length and MAX_COUNTING_SORT_RANGE, as 8-bit keys, status codes and
+     * small enumerations are. The range of wider keys is first estimated
+     * from a sample, so that wide ranges cost no pass over the array.
+     *
+     * @param a the array to be sorted
+     * @param n the length of the array
+     * @param cnt the counters, kept across calls so that they are reused
+     * @return true if the array is sorted, false if it is left as it is
+     */
+    template <typename T, typename Key = RadixKey<T> >
+    bool narrowRangeSort(T *a, Index n, std::vector<Index> &cnt) {
+        using Integral = std::is_integral<typename KeyType<T>::type>;
+        return narrowRangeSort<T, Key>(a, n, cnt, std::integral_constant<bool, Integral::value>());
+    }
+
+    /**
+     * Sorts the specified array by counting sort if its keys are integers
+     * in a narrow range, as narrowRangeSort(a, n, cnt) does with counters
+     * of its own.
+     *
+     * @param a the array to be sorted
+     * @param n the length of the array
+     * @return true if the array is sorted, false if it is left as it is
+     */
+    template <typename T, typename Key = RadixKey<T> >
+    bool narrowRangeSort(T *a, Index n) {
+        std::vector<Index> cnt;
+        return narrowRangeSort<T, Key>(a, n, cnt);
+    }
+
+    /**
+     * Checks if narrowRangeSort sorts every array of n keys of type T, as
+     * it does long arrays of 8-bit and 16-bit integers, whose whole range
+     * is narrow enough to be counted.
+     *
+     * @param n the length of the array
+     */
+    template <typename T>
+    inline bool countsEveryArray(Index n) {
+        using K = typename KeyType<T>::type;
+        return std::is_integral<K>::value && n >= COUNTING_SORT_THRESHOLD &&
+               (sizeof(K) == 1 || (sizeof(K) == 2 && 4 * n >= MAX_COUNTING_SORT_RANGE));
+    }
+
+    /**
+     * Returns the digit width of LSD radix sort for n keys of the given size.
+     * Wider digits take fewer passes over the array, but scatter into more
+     * buckets, which only pays off once n is large enough. Past 2^26 keys the
+     * 65536 buckets of 16-bit digits thrash the TLB.
+     *
+     * @param n the length of the array
+     * @param keySize the size of the radix key in bytes
+     */
+    inline int radixDigitBits(Index n, int keySize) {
+        if (keySize < 4 || n < (1 << 20)) return 8;
+        if (n >= (1 << 26)) return 11;
+        return n >= (keySize == 4 ? 1 << 23 : 1 << 21) ? 16 : 11;
+    }
+
+    /**
+     * Sorts the specified array by LSD radix sort with the digit width
+     * chosen by radixDigitBits.
+     *
+     * @param a the array to be sorted
+     * @param n the length of the array
+     * @param work a workspace array of at least n elements,
+     *             or nullptr to create one if needed
+     */
+    template <typename T, typename Key = RadixKey<T> >
+    void adaptiveRadixSort(T *a, Index n, T *work = nullptr) {
+        switch (radixDigitBits(n, sizeof(typename Key::Type))) {
+            case 16:
+                lsdRadixSortDigits<16, T, Key>(a, n, work);
+                break;
+            case 11:
+                lsdRadixSortDigits<11, T, Key>(a, n, work);
+                break;
+            default:
+                lsdRadixSortDigits<8, T, Key>(a, n, work);
+        }
+    }
+
+    /**
+     * Sorts the specified array of composite keys, which may be too wide
+     * for one radix key, by LSD radix sort on the prefix keys of their
+     * leading fields, and then sorts each run of keys of the same prefix
+     * key by Dual-Pivot Quicksort on the other fields. Key is the prefix
+     * key, which Compare must extend.
+     *
+     * @param a the array to be sorted
+     * @param n the length of the array
+     * @param comp the comparator
+     */
+    template <typename T, typename Key, typename Compare>
+    void prefixRadixSort(T *a, Index n, Compare comp) {
+        adaptiveRadixSort<T, Key>(a, n);
+        for (Index i = 0, j; i < n; i = j) {
+            const typename Key::Type key = Key::encode(a[i]);
+            for (j = i + 1; j < n && Key::encode(a[j]) == key; j++) {}
+            if (j - i > 1) dualPivotQuickSort(a, i, j - 1, i == 0, quickSortDepth(j - i), comp);
+        }
+    }
+
+    /**
+     * Sorts the specified array by LSD radix sort, or in place by American
+     * flag sort if the scratch buffer would be too large. Key and Compare
+     * must define the same order.
+     *
+     * @param a the array to be sorted
+     * @param n the length of the array
+     * @param work a workspace array of at least n elements,
+     *             or nullptr to create one if needed
+     */
+    template <typename T, typename Key = RadixKey<T>, typename Compare = std::less<T> >
+    inline void hybridRadixSort(T *a, Index n, T *work = nullptr) {
+        if (sizeof(T) * n > MAX_RADIX_SORT_BUFFER_SIZE) {
+            americanFlagSort<T, Key>(a, n, Compare());
+        } else {
+            adaptiveRadixSort<T, Key>(a, n, work);
+        }
+    }
+
+    /**
+     * Sorts the specified array in descending order by radix sort on the
+     * complemented keys, so no reversing pass is needed.
+     *
+     * @param a the array to be sorted
+     * @param n the length of the array
+     */
+    template <typename T>
+    inline void descendingRadixSort(T *a, Index n) {
+        hybridRadixSort<T, DescendingRadixKey<RadixKey<T> >, std::greater<T> >(a, n);
+    }
+
+    template <typename T>
+    inline void radixSort(T *a, Index n, std::true_type) {
+        hybridRadixSort(a, n);
+    }
+
+    template <typename T>
+    inline void radixSort(T *a, Index n, std::false_type) {
+        std::sort(a, a + n);
+    }
+
+    /**
+     * Sorts the specified array by radix sort if its type has a radix key,
+     * and by std::sort otherwise.
+     *
+     * @param a the array to be sorted
+     * @param n the length of the array
+     */
+    template <typename T>
+    void radixSort(T *a, Index n) {
+        radixSort(a, n, std::integral_constant<bool, HasRadixKey<T>::value>());
+    }
+
+    template <typename T>
+    inline void inPlaceRadixSort(T *a, Index n, std::true_type) {
+        if (!narrowRangeSort(a, n)) americanFlagSort(a, n);
+    }
+
+    template <typename T>
+    inline void inPlaceRadixSort(T *a, Index n, std::false_type) {
+        std::sort(a, a + n);
+    }
+
+    /**
+     * Sorts the specified array with O(log n) extra memory.
+     *
+     * @param a the array to be sorted
+     * @param n the length of the array
+     */
+    template <typename T>
+    void inPlaceRadixSort(T *a, Index n) {
+        inPlaceRadixSort(a, n, std::integral_constant<bool, HasRadixKey<T>::value>());
     }
 
 }  // namespace HybridSort
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,217 @@
+/**
+ * Sorting Network
+ *
+ * Copyright (c) 2019, xehoth
+ * All rights reserved.
+ *
+ * Licensed under the MIT License;
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author xehoth
+ */
+#ifndef _SORTING_NETWORK_HPP_
+#define _SORTING_NETWORK_HPP_
+#include "Comparator.hpp"
+#include "RadixKey.hpp"
+#include <functional>
+#include <type_traits>
+
+namespace HybridSort {
+
+    /**
+     * If the length of an array of arithmetic type to be sorted is not
+     * greater than this constant, a sorting network is used in preference
+     * to insertion sort.
+     */
+    const int SORTING_NETWORK_THRESHOLD = 16;
+
+    /**
+     * Whether tiny arrays of type T ordered by Compare are sorted by sorting
+     * networks, which pays off when copies and comparisons are cheap.
+     */
+    template <typename T, typename Compare = std::less<T> >
+    struct UseSortingNetwork
+        : std::integral_constant<bool, (std::is_integral<T>::value || std::is_enum<T>::value ||
+                                        std::is_same<T, float>::value ||
+                                        std::is_same<T, double>::value) &&
+                                           (IsLessCompare<Compare, T>::value ||
+                                            IsGreaterCompare<Compare, T>::value)> {};
+
+    /**
+     * The keys the networks compare. Integers are compared as they are.
+     * Floating-point numbers are compared by their radix keys, which lets
+     * the compiler select with conditional moves instead of branches, and
+     * keeps NaN and signed zeros intact. Descending order complements
+     * the radix keys, so they are always compared by operator<.
+     */
+    template <typename T, typename Compare, bool = std::is_floating_point<T>::value>
+    struct NetworkKey {
+        using Type = T;
+
+        static Type encode(T x) { return x; }
+
+        static T decode(Type x) { return x; }
+
+        static Compare compare(Compare comp) { return comp; }
+    };
+
+    template <typename T, typename Compare>
+    struct NetworkKey<T, Compare, true>
+        : std::conditional<IsGreaterCompare<Compare, T>::value, DescendingRadixKey<RadixKey<T> >,
+                           RadixKey<T> >::type {
+        static std::less<typename RadixKey<T>::Type> compare(Compare) {
+            return std::less<typename RadixKey<T>::Type>();
+        }
+    };
+
+    /*
+     * The networks are Batcher's odd-even merge sort on the next power of two
+     * of N, unrolled at compile time. Comparators which touch an index not
+     * less than N are dropped, as if the missing elements were infinite, so
+     * every N gets a network of its exact size and needs no padding keys.
+     */
+
+    /**
+     * Puts the first one of a[I] and a[J] in the order of comp into a[I]
+     * and the other one into a[J] without branches.
+     */
+    template <int N, int I, int J, bool = (J < N)>
+    struct CompareExchange {
+        template <typename T, typename Compare>
+        static void apply(T *a, Compare comp) {
+            const T x = a[I], y = a[J];
+            const bool swap = comp(y, x);
+            a[I] = swap ? y : x;
+            a[J] = swap ? x : y;
+        }
+    };
+
+    template <int N, int I, int J>
+    struct CompareExchange<N, I, J, false> {
+        template <typename T, typename Compare>
+        static void apply(T *, Compare) {}
+    };
+
+    /**
+     * Compare-exchanges a[I] with a[I + R] for I in [I, END) stepping by M.
+     */
+    template <int N, int I, int END, int M, int R, bool = (I < END && I + R < N)>
+    struct OddEvenMergeStep {
+        template <typename T, typename Compare>
+        static void apply(T *a, Compare comp) {
+            CompareExchange<N, I, I + R>::apply(a, comp);
+            OddEvenMergeStep<N, I + M, END, M, R>::apply(a, comp);
+        }
+    };
+
+    template <int N, int I, int END, int M, int R>
+    struct OddEvenMergeStep<N, I, END, M, R, false> {
+        template <typename T, typename Compare>
+        static void apply(T *, Compare) {}
+    };
+
+    /**
+     * Merges the sorted halves of the SIZE elements from LO, looking at the
+     * elements R apart.
+     */
+    template <int N, int LO, int SIZE, int R, bool = (R * 2 < SIZE)>
+    struct OddEvenMerge {
+        template <typename T, typename Compare>
+        static void apply(T *a, Compare comp) {
+            OddEvenMerge<N, LO, SIZE, R * 2>::apply(a, comp);
+            OddEvenMerge<N, LO + R, SIZE, R * 2>::apply(a, comp);
+            OddEvenMergeStep<N, LO + R, LO + SIZE - R, R * 2, R>::apply(a, comp);
+        }
+    };
+
+    template <int N, int LO, int SIZE, int R>
+    struct OddEvenMerge<N, LO, SIZE, R, false> {
+        template <typename T, typename Compare>
+        static void apply(T *a, Compare comp) {
+            CompareExchange<N, LO, LO + R>::apply(a, comp);
+        }
+    };
+
+    /**
+     * Sorts the SIZE elements from LO, SIZE is a power of two.
+     */
+    template <int N, int LO, int SIZE, bool = (SIZE > 1 && LO < N)>
+    struct OddEvenMergeSort {
+        template <typename T, typename Compare>
+        static void apply(T *a, Compare comp) {
+            OddEvenMergeSort<N, LO, SIZE / 2>::apply(a, comp);
+            OddEvenMergeSort<N, LO + SIZE / 2, SIZE / 2>::apply(a, comp);
+            OddEvenMerge<N, LO, SIZE, 1>::apply(a, comp);
+        }
+    };
+
+    template <int N, int LO, int SIZE>
+    struct OddEvenMergeSort<N, LO, SIZE, false> {
+        template <typename T, typename Compare>
+        static void apply(T *, Compare) {}
+    };
+
+    template <int N, int P = 1, bool = (P >= N)>
+    struct SortingNetwork : SortingNetwork<N, P * 2> {};
+
+    /**
+     * Sorting network of exactly N elements. The keys are copied into
+     * locals so that they can be kept in registers.
+     */
+    template <int N, int P>
+    struct SortingNetwork<N, P, true> {
+        template <typename T, typename Compare>
+        static void sort(T *a, Compare comp) {
+            using Key = NetworkKey<T, Compare>;
+            typename Key::Type v[N];
+            for (int i = 0; i < N; i++) v[i] = Key::encode(a[i]);
+            OddEvenMergeSort<N, 0, P>::apply(v, Key::compare(comp));
+            for (int i = 0; i < N; i++) a[i] = Key::decode(v[i]);
+        }
+    };
+
+    /**
+     * Sorts the specified tiny array by the sorting network of its length.
+     *
+     * @param a the array to be sorted
+     * @param n the length of the array, not greater than SORTING_NETWORK_THRESHOLD
+     * @param comp the comparator, std::less or std::greater for floating-point types
+     */
+    template <typename T, typename Compare = std::less<T> >
+    void sortingNetwork(T *a, int n, Compare comp = Compare()) {
+        switch (n) {
+            case 2: SortingNetwork<2>::sort(a, comp); break;
+            case 3: SortingNetwork<3>::sort(a, comp); break;
+            case 4: SortingNetwork<4>::sort(a, comp); break;
+            case 5: SortingNetwork<5>::sort(a, comp); break;
+            case 6: SortingNetwork<6>::sort(a, comp); break;
+            case 7: SortingNetwork<7>::sort(a, comp); break;
+            case 8: SortingNetwork<8>::sort(a, comp); break;
+            case 9: SortingNetwork<9>::sort(a, comp); break;
+            case 10: SortingNetwork<10>::sort(a, comp); break;
+            case 11: SortingNetwork<11>::sort(a, comp); break;
+            case 12: SortingNetwork<12>::sort(a, comp); break;
+            case 13: SortingNetwork<13>::sort(a, comp); break;
+            case 14: SortingNetwork<14>::sort(a, comp); break;
+            case 15: SortingNetwork<15>::sort(a, comp); break;
+            case 16: SortingNetwork<16>::sort(a, comp); break;
+        }
+    }
+}  // namespace HybridSort
+#endif
@@ -0,0 +1,627 @@
+/**
+ * Vectorized Quicksort
+ *
+ * Copyright (c) 2019, xehoth
+ * All rights reserved.
+ *
+ * Licensed under the MIT License;
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author xehoth
+ */
+#ifndef _VECTORIZED_QUICK_SORT_HPP_
+#define _VECTORIZED_QUICK_SORT_HPP_
+#include "DualPivotQuickSort.hpp"
+#include <climits>
+#include <functional>
+#include <type_traits>
+
+/*
+ * The SIMD kernels are compiled with per-function target attributes and
+ * selected at runtime, so the library itself needs no -mavx2 or -mavx512f.
+ * Define HYBRID_SORT_NO_SIMD to always use the scalar Dual-Pivot Quicksort.
+ */
+#if !defined(HYBRID_SORT_NO_SIMD) && (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define HYBRID_SORT_SIMD
+#define HYBRID_SORT_AVX2 __attribute__((target("avx2,popcnt")))
+#define HYBRID_SORT_AVX512 __attribute__((target("avx512f,popcnt")))
+#include <immintrin.h>
+#endif
+
+namespace HybridSort {
+
+    /**
+     * If the length of a range is less than this constant, the vectorized
+     * quick sort hands it to the scalar Dual-Pivot Quicksort.
+     */
+    const int VECTORIZED_QUICKSORT_THRESHOLD = 128;
+
+    /**
+     * Quicksort engine which partitions with SIMD instructions for the key
+     * types the vector kernels support.
+     */
+    struct VectorizedQuickSort {};
+
+    /**
+     * The instruction sets the vector kernels can run on.
+     */
+    enum SimdLevel { SIMD_SCALAR, SIMD_AVX2, SIMD_AVX512 };
+
+    inline int detectSimdLevel() {
+#ifdef HYBRID_SORT_SIMD
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("popcnt"))
+            return SIMD_AVX512;
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) return SIMD_AVX2;
+#endif
+        return SIMD_SCALAR;
+    }
+
+    /**
+     * The best instruction set supported by this CPU, detected once.
+     */
+    inline int simdLevel() {
+        static const int level = detectSimdLevel();
+        return level;
+    }
+
+    /**
+     * Whether the vector kernels support keys of type T: float, double and
+     * the 32-bit and 64-bit integral and enumeration types.
+     */
+    template <typename T>
+    struct IsVectorizable
+        : std::integral_constant<bool, IsPrimitiveKey<T>::value && HasRadixKey<T>::value &&
+                                           (sizeof(T) == 4 || sizeof(T) == 8)> {};
+
+#ifdef HYBRID_SORT_SIMD
+    /**
+     * Lane permutations which move the lanes selected by an 8-bit mask in
+     * front of the others, one index byte per 32-bit lane.
+     */
+    struct LanePermutation {
+        unsigned long long table[256];
+
+        LanePermutation() {
+            for (int m = 0; m < 256; m++) {
+                unsigned long long p = 0;
+                int k = 0;
+                for (int i = 0; i < 8; i++)
+                    if (m >> i & 1) p |= static_cast<unsigned long long>(i) << (8 * k++);
+                for (int i = 0; i < 8; i++)
+                    if (!(m >> i & 1)) p |= static_cast<unsigned long long>(i) << (8 * k++);
+                table[m] = p;
+            }
+        }
+    };
+
+    inline const unsigned long long *lanePermutation() {
+        static const LanePermutation permutation;
+        return permutation.table;
+    }
+
+    /**
+     * AVX2 operations on 8 lanes of 32-bit keys. Unsigned keys are compared
+     * as signed ones after flipping the sign bit.
+     */
+    template <typename T, int BIAS>
+    struct Avx2Int32 {
+        static const int LANES = 8;
+        using Vector = __m256i;
+
+        HYBRID_SORT_AVX2 static Vector load(const T *p) {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+        }
+
+        HYBRID_SORT_AVX2 static void store(T *p, Vector v) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v);
+        }
+
+        HYBRID_SORT_AVX2 static Vector set1(T x) {
+            return _mm256_set1_epi32(static_cast<int>(x) ^ BIAS);
+        }
+
+        HYBRID_SORT_AVX2 static int less(Vector v, Vector pivot) {
+            v = _mm256_xor_si256(v, _mm256_set1_epi32(BIAS));
+            return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(pivot, v)));
+        }
+
+        HYBRID_SORT_AVX2 static int greater(Vector v, Vector pivot) {
+            v = _mm256_xor_si256(v, _mm256_set1_epi32(BIAS));
+            return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(v, pivot)));
+        }
+
+        HYBRID_SORT_AVX2 static Vector permute(Vector v, int mask,
+                                               const unsigned long long *permutation) {
+            __m256i index = _mm256_cvtepu8_epi32(
+                _mm_cvtsi64_si128(static_cast<long long>(permutation[mask])));
+            return _mm256_permutevar8x32_epi32(v, index);
+        }
+    };
+
+    /**
+     * AVX2 kernels are only used for 32-bit keys, four 64-bit lanes don't
+     * pay for the permutation.
+     */
+    template <typename T>
+    struct Avx2Vector
+        : Avx2Int32<T, std::is_signed<typename KeyType<T>::type>::value ? 0 : INT_MIN> {};
+
+    template <>
+    struct Avx2Vector<float> {
+        static const int LANES = 8;
+        using Vector = __m256;
+
+        HYBRID_SORT_AVX2 static Vector load(const float *p) { return _mm256_loadu_ps(p); }
+
+        HYBRID_SORT_AVX2 static void store(float *p, Vector v) { _mm256_storeu_ps(p, v); }
+
+        HYBRID_SORT_AVX2 static Vector set1(float x) { return _mm256_set1_ps(x); }
+
+        HYBRID_SORT_AVX2 static int less(Vector v, Vector pivot) {
+            return _mm256_movemask_ps(_mm256_cmp_ps(v, pivot, _CMP_LT_OQ));
+        }
+
+        HYBRID_SORT_AVX2 static int greater(Vector v, Vector pivot) {
+            return _mm256_movemask_ps(_mm256_cmp_ps(v, pivot, _CMP_GT_OQ));
+        }
+
+        HYBRID_SORT_AVX2 static Vector permute(Vector v, int mask,
+                                               const unsigned long long *permutation) {
+            __m256i index = _mm256_cvtepu8_epi32(
+                _mm_cvtsi64_si128(static_cast<long long>(permutation[mask])));
+            return _mm256_permutevar8x32_ps(v, index);
+        }
+    };
+
+    /**
+     * AVX-512 operations on integral and enumeration keys of SIZE bytes.
+     */
+    template <typename T, int SIZE = sizeof(T),
+              bool SIGNED = std::is_signed<typename KeyType<T>::type>::value>
+    struct Avx512Integer;
+
+    template <typename T>
+    struct Avx512Integer<T, 4, true> {
+        static const int LANES = 16;
+        using Vector = __m512i;
+
+        HYBRID_SORT_AVX512 static Vector load(const T *p) { return _mm512_loadu_si512(p); }
+
+        HYBRID_SORT_AVX512 static void store(T *p, Vector v, int n) {
+            _mm512_mask_storeu_epi32(p, static_cast<__mmask16>((1 << n) - 1), v);
+        }
+
+        HYBRID_SORT_AVX512 static Vector set1(T x) {
+            return _mm512_set1_epi32(static_cast<int>(x));
+        }
+
+        HYBRID_SORT_AVX512 static int less(Vector v, Vector pivot) {
+            return _mm512_cmplt_epi32_mask(v, pivot);
+        }
+
+        HYBRID_SORT_AVX512 static int greater(Vector v, Vector pivot) {
+            return _mm512_cmpgt_epi32_mask(v, pivot);
+        }
+
+        HYBRID_SORT_AVX512 static Vector compress(Vector v, int mask) {
+            return _mm512_maskz_compress_epi32(static_cast<__mmask16>(mask), v);
+        }
+    };
+
+    template <typename T>
+    struct Avx512Integer<T, 4, false> {
+        static const int LANES = 16;
+        using Vector = __m512i;
+
+        HYBRID_SORT_AVX512 static Vector load(const T *p) { return _mm512_loadu_si512(p); }
+
+        HYBRID_SORT_AVX512 static void store(T *p, Vector v, int n) {
+            _mm512_mask_storeu_epi32(p, static_cast<__mmask16>((1 << n) - 1), v);
+        }
+
+        HYBRID_SORT_AVX512 static Vector set1(T x) {
+            return _mm512_set1_epi32(static_cast<int>(x));
+        }
+
+        HYBRID_SORT_AVX512 static int less(Vector v, Vector pivot) {
+            return _mm512_cmplt_epu32_mask(v, pivot);
+        }
+
+        HYBRID_SORT_AVX512 static int greater(Vector v, Vector pivot) {
+            return _mm512_cmpgt_epu32_mask(v, pivot);
+        }
+
+        HYBRID_SORT_AVX512 static Vector compress(Vector v, int mask) {
+            return _mm512_maskz_compress_epi32(static_cast<__mmask16>(mask), v);
+        }
+    };
+
+    template <typename T>
+    struct Avx512Integer<T, 8, true> {
+        static const int LANES = 8;
+        using Vector = __m512i;
+
+        HYBRID_SORT_AVX512 static Vector load(const T *p) { return _mm512_loadu_si512(p); }
+
+        HYBRID_SORT_AVX512 static void store(T *p, Vector v, int n) {
+            _mm512_mask_storeu_epi64(p, static_cast<__mmask8>((1 << n) - 1), v);
+        }
+
+        HYBRID_SORT_AVX512 static Vector set1(T x) {
+            return _mm512_set1_epi64(static_cast<long long>(x));
+        }
+
+        HYBRID_SORT_AVX512 static int less(Vector v, Vector pivot) {
+            return _mm512_cmplt_epi64_mask(v, pivot);
+        }
+
+        HYBRID_SORT_AVX512 static int greater(Vector v, Vector pivot) {
+            return _mm512_cmpgt_epi64_mask(v, pivot);
+        }
+
+        HYBRID_SORT_AVX512 static Vector compress(Vector v, int mask) {
+            return _mm512_maskz_compress_epi64(static_cast<__mmask8>(mask), v);
+        }
+    };
+
+    template <typename T>
+    struct Avx512Integer<T, 8, false> {
+        static const int LANES = 8;
+        using Vector = __m512i;
+
+        HYBRID_SORT_AVX512 static Vector load(const T *p) { return _mm512_loadu_si512(p); }
+
+        HYBRID_SORT_AVX512 static void store(T *p, Vector v, int n) {
+            _mm512_mask_storeu_epi64(p, static_cast<__mmask8>((1 << n) - 1), v);
+        }
+
+        HYBRID_SORT_AVX512 static Vector set1(T x) {
+            return _mm512_set1_epi64(static_cast<long long>(x));
+        }
+
+        HYBRID_SORT_AVX512 static int less(Vector v, Vector pivot) {
+            return _mm512_cmplt_epu64_mask(v, pivot);
+        }
+
+        HYBRID_SORT_AVX512 static int greater(Vector v, Vector pivot) {
+            return _mm512_cmpgt_epu64_mask(v, pivot);
+        }
+
+        HYBRID_SORT_AVX512 static Vector compress(Vector v, int mask) {
+            return _mm512_maskz_compress_epi64(static_cast<__mmask8>(mask), v);
+        }
+    };
+
+    /**
+     * AVX-512 operations, the lanes on each side of the pivot are packed
+     * with compress and written with masked stores.
+     */
+    template <typename T>
+    struct Avx512Vector : Avx512Integer<T> {};
+
+    template <>
+    struct Avx512Vector<float> {
+        static const int LANES = 16;
+        using Vector = __m512;
+
+        HYBRID_SORT_AVX512 static Vector load(const float *p) { return _mm512_loadu_ps(p); }
+
+        HYBRID_SORT_AVX512 static void store(float *p, Vector v, int n) {
+            _mm512_mask_storeu_ps(p, static_cast<__mmask16>((1 << n) - 1), v);
+        }
+
+        HYBRID_SORT_AVX512 static Vector set1(float x) { return _mm512_set1_ps(x); }
+
+        HYBRID_SORT_AVX512 static int less(Vector v, Vector pivot) {
+            return _mm512_cmp_ps_mask(v, pivot, _CMP_LT_OQ);
+        }
+
+        HYBRID_SORT_AVX512 static int greater(Vector v, Vector pivot) {
+            return _mm512_cmp_ps_mask(v, pivot, _CMP_GT_OQ);
+        }
+
+        HYBRID_SORT_AVX512 static Vector compress(Vector v, int mask) {
+            return _mm512_maskz_compress_ps(static_cast<__mmask16>(mask), v);
+        }
+    };
+
+    template <>
+    struct Avx512Vector<double> {
+        static const int LANES = 8;
+        using Vector = __m512d;
+
+        HYBRID_SORT_AVX512 static Vector load(const double *p) { return _mm512_loadu_pd(p); }
+
+        HYBRID_SORT_AVX512 static void store(double *p, Vector v, int n) {
+            _mm512_mask_storeu_pd(p, static_cast<__mmask8>((1 << n) - 1), v);
+        }
+
+        HYBRID_SORT_AVX512 static Vector set1(double x) { return _mm512_set1_pd(x); }
+
+        HYBRID_SORT_AVX512 static int less(Vector v, Vector pivot) {
+            return _mm512_cmp_pd_mask(v, pivot, _CMP_LT_OQ);
+        }
+
+        HYBRID_SORT_AVX512 static int greater(Vector v, Vector pivot) {
+            return _mm512_cmp_pd_mask(v, pivot, _CMP_GT_OQ);
+        }
+
+        HYBRID_SORT_AVX512 static Vector compress(Vector v, int mask) {
+            return _mm512_maskz_compress_pd(static_cast<__mmask8>(mask), v);
+        }
+    };
+
+    /*
+     * Both partition kernels below work in place. One vector from each end
+     * of the range is held in registers, which leaves 2 * LANES free slots.
+     * Every step loads the next vector from the side with fewer free slots,
+     * so both sides keep at least LANES free slots, and writes its lanes less
+     * than the pivot to the left and the others to the right. The tail and
+     * the two held vectors are written into the gap left in the middle.
+     * For descending order, the roles of less and greater are swapped.
+     */
+
+    /**
+     * Partitions the range [left, right) of the array with AVX2, moving the
+     * elements which comp orders before the pivot (not after it if orEqual)
+     * to the left. The lanes of each vector are permuted by a lookup table,
+     * and the whole vector is stored on both sides.
+     *
+     * @return the index of the first element of the right part
+     */
+    template <typename V, typename T, typename Compare>
+    HYBRID_SORT_AVX2 Index avx2Partition(T *a, Index left, Index right, T pivot, bool orEqual,
+                                         Compare comp) {
+        const int W = V::LANES, FULL = (1 << W) - 1;
+        const bool descending = IsGreaterCompare<Compare, T>::value;
+        const unsigned long long *permutation = lanePermutation();
+        const typename V::Vector p = V::set1(pivot);
+        const typename V::Vector first = V::load(a + left), last = V::load(a + right - W);
+        Index l = left + W, r = right - W, wl = left, wr = right;
+        while (r - l >= W) {
+            typename V::Vector v;
+            if (l - wl <= wr - r) {
+                v = V::load(a + l);
+                l += W;
+            } else {
+                r -= W;
+                v = V::load(a + r);
+            }
+            int mask = orEqual ? ~(descending ? V::less(v, p) : V::greater(v, p)) & FULL
+                               : (descending ? V::greater(v, p) : V::less(v, p));
+            int cnt = __builtin_popcount(mask);
+            v = V::permute(v, mask, permutation);
+            V::store(a + wl, v);
+            wl += cnt;
+            wr -= W - cnt;
+            V::store(a + wr - cnt, v);
+        }
+        T tail[16];
+        const int n = static_cast<int>(r - l);
+        for (int i = 0; i < n; i++) tail[i] = a[l + i];
+        for (int i = 0; i < n; i++) {
+            if (orEqual ? !comp(pivot, tail[i]) : comp(tail[i], pivot)) {
+                a[wl++] = tail[i];
+            } else {
+                a[--wr] = tail[i];
+            }
+        }
+        const typename V::Vector held[2] = {first, last};
+        for (typename V::Vector v : held) {
+            int mask = orEqual ? ~(descending ? V::less(v, p) : V::greater(v, p)) & FULL
+                               : (descending ? V::greater(v, p) : V::less(v, p));
+            int cnt = __builtin_popcount(mask);
+            v = V::permute(v, mask, permutation);
+            V::store(a + wl, v);
+            wl += cnt;
+            wr -= W - cnt;
+            V::store(a + wr - cnt, v);
+        }
+        return wl;
+    }
+
+    /**
+     * Partitions the range [left, right) of the array with AVX-512, moving
+     * the elements which comp orders before the pivot (not after it if
+     * orEqual) to the left.
+     *
+     * @return the index of the first element of the right part
+     */
+    template <typename V, typename T, typename Compare>
+    HYBRID_SORT_AVX512 Index avx512Partition(T *a, Index left, Index right, T pivot,
+                                             bool orEqual, Compare comp) {
+        const int W = V::LANES, FULL = (1 << W) - 1;
+        const bool descending = IsGreaterCompare<Compare, T>::value;
+        const typename V::Vector p = V::set1(pivot);
+        const typename V::Vector first = V::load(a + left), last = V::load(a + right - W);
+        Index l = left + W, r = right - W, wl = left, wr = right;
+        while (r - l >= W) {
+            typename V::Vector v;
+            if (l - wl <= wr - r) {
+                v = V::load(a + l);
+                l += W;
+            } else {
+                r -= W;
+                v = V::load(a + r);
+            }
+            int mask = orEqual ? ~(descending ? V::less(v, p) : V::greater(v, p)) & FULL
+                               : (descending ? V::greater(v, p) : V::less(v, p));
+            int cnt = __builtin_popcount(mask);
+            V::store(a + wl, V::compress(v, mask), cnt);
+            wl += cnt;
+            wr -= W - cnt;
+            V::store(a + wr, V::compress(v, ~mask & FULL), W - cnt);
+        }
+        T tail[16];
+        const int n = static_cast<int>(r - l);
+        for (int i = 0; i < n; i++) tail[i] = a[l + i];
+        for (int i = 0; i < n; i++) {
+            if (orEqual ? !comp(pivot, tail[i]) : comp(tail[i], pivot)) {
+                a[wl++] = tail[i];
+            } else {
+                a[--wr] = tail[i];
+            }
+        }
+        const typename V::Vector held[2] = {first, last};
+        for (typename V::Vector v : held) {
+            int mask = orEqual ? ~(descending ? V::less(v, p) : V::greater(v, p)) & FULL
+                               : (descending ? V::greater(v, p) : V::less(v, p));
+            int cnt = __builtin_popcount(mask);
+            V::store(a + wl, V::compress(v, mask), cnt);
+            wl += cnt;
+            wr -= W - cnt;
+            V::store(a + wr, V::compress(v, ~mask & FULL), W - cnt);
+        }
+        return wl;
+    }
+
+    template <typename T, typename Compare>
+    inline Index vectorPartition(T *a, Index left, Index right, T pivot, bool orEqual, int level,
+                                 Compare comp, std::true_type) {
+        return level == SIMD_AVX512
+                   ? avx512Partition<Avx512Vector<T> >(a, left, right, pivot, orEqual, comp)
+                   : avx2Partition<Avx2Vector<T> >(a, left, right, pivot, orEqual, comp);
+    }
+
+    template <typename T, typename Compare>
+    inline Index vectorPartition(T *a, Index left, Index right, T pivot, bool orEqual,
+                                 int /* level */, Compare comp, std::false_type) {
+        return avx512Partition<Avx512Vector<T> >(a, left, right, pivot, orEqual, comp);
+    }
+
+    template <typename T, typename Compare>
+    inline Index vectorPartition(T *a, Index left, Index right, T pivot, bool orEqual, int level,
+                                 Compare comp) {
+        return vectorPartition(a, left, right, pivot, orEqual, level, comp,
+                               std::integral_constant<bool, sizeof(T) == 4>());
+    }
+
+    /**
+     * Sorts the specified range of the array by quicksort with vectorized
+     * partitioning. Elements equal to a pivot which is the minimum of the
+     * range are split off by a second pass, so duplicates can't make it
+     * quadratic. Deep recursion and short ranges go to Dual-Pivot Quicksort.
+     *
+     * @param a the array to be sorted
+     * @param left the index of the first element, inclusive, to be sorted
+     * @param right the index of the last element, inclusive, to be sorted
+     * @param leftmost indicates if this part is the leftmost in the range
+     * @param depth the number of partitioning steps left before giving up
+     * @param level the instruction set to partition with
+     * @param comp the comparator, std::less or std::greater
+     */
+    template <typename T, typename Compare>
+    void vectorizedQuickSort(T *a, Index left, Index right, bool leftmost, int depth, int level,
+                             Compare comp) {
+        while (right - left + 1 >= VECTORIZED_QUICKSORT_THRESHOLD && --depth >= 0) {
+            // Use the median of five evenly spaced elements as the pivot
+            const Index step = (right - left) / 4;
+            T e[5] = {a[left], a[left + step], a[left + 2 * step], a[left + 3 * step], a[right]};
+            for (int i = 1; i < 5; i++)
+                for (int j = i; j > 0 && comp(e[j], e[j - 1]); j--) std::swap(e[j], e[j - 1]);
+            const T pivot = e[2];
+
+            Index mid = vectorPartition(a, left, right + 1, pivot, false, level, comp);
+            if (mid == left) {
+                // The pivot is the first in order, all elements equal to it are in place
+                mid = vectorPartition(a, left, right + 1, pivot, true, level, comp);
+                if (mid == left) break;  // Unordered keys such as NaN
+                left = mid;
+                leftmost = false;
+            } else if (mid - left < right - mid) {
+                vectorizedQuickSort(a, left, mid - 1, leftmost, depth, level, comp);
+                left = mid;
+                leftmost = false;
+            } else {
+                vectorizedQuickSort(a, mid, right, false, depth, level, comp);
+                right = mid - 1;
+            }
+        }
+        if (left < right)
+            dualPivotQuickSort(a, left, right, leftmost, quickSortDepth(right - left + 1), comp);
+    }
+#endif
+
+    template <typename T, typename Compare>
+    inline void vectorizedQuickSort(T *a, Index left, Index right, int /* level */,
+                                    Compare comp, std::false_type) {
+        dualPivotQuickSort(a, left, right, true, quickSortDepth(right - left + 1), comp);
+    }
+
+    template <typename T, typename Compare>
+    inline void vectorizedQuickSort(T *a, Index left, Index right, int level, Compare comp,
+                                    std::true_type) {
+#ifdef HYBRID_SORT_SIMD
+        if (level == SIMD_AVX2 && sizeof(T) != 4) level = SIMD_SCALAR;
+        if (level != SIMD_SCALAR) {
+            vectorizedQuickSort(a, left, right, true, quickSortDepth(right - left + 1), level,
+                                comp);
+            return;
+        }
+#else
+        (void) level;
+#endif
+        dualPivotQuickSort(a, left, right, true, quickSortDepth(right - left + 1), comp);
+    }
+
+    /**
+     * Sorts the specified range of the array with the vector kernels of the
+     * given instruction set, or with Dual-Pivot Quicksort for other types
+     * and comparators other than std::less and std::greater.
+     *
+     * @param a the array to be sorted
+     * @param left the index of the first element, inclusive, to be sorted
+     * @param right the index of the last element, inclusive, to be sorted
+     * @param level the instruction set to use, at most simdLevel()
+     * @param comp the comparator
+     */
+    template <typename T, typename Compare = std::less<T> >
+    inline void vectorizedQuickSort(T *a, Index left, Index right, int level,
+                                    Compare comp = Compare()) {
+        const bool vectorizable = IsVectorizable<T>::value && (IsLessCompare<Compare, T>::value ||
+                                                               IsGreaterCompare<Compare, T>::value);
+        vectorizedQuickSort(a, left, right, level, comp,
+                            std::integral_constant<bool, vectorizable>());
+    }
+
+    template <typename T, typename Compare>
+    inline void quickSort(T *a, Index left, Index right, Compare comp, VectorizedQuickSort) {
+        vectorizedQuickSort(a, left, right, simdLevel(), comp);
+    }
+
+    /**
+     * Sorts the range with Dual-Pivot Quicksort, merging it if it is made of
+     * a few runs and partitioning it with the vector kernels otherwise.
+     */
+    template <typename T>
+    inline void vectorizedQuickSort(T begin, T end) {
+        dualPivotQuickSort<typename std::remove_reference<decltype(*begin)>::type,
+                           VectorizedQuickSort>(&(*begin), 0, end - begin - 1, nullptr, 0, 0, 0);
+    }
+
+    template <typename T, typename Compare>
+    inline void vectorizedQuickSort(T begin, T end, Compare comp) {
+        dualPivotQuickSort<typename std::remove_reference<decltype(*begin)>::type,
+                           VectorizedQuickSort>(&(*begin), 0, end - begin - 1, nullptr, 0, 0, 0,
+                                                comp);
+    }
+}  // namespace HybridSort
+#endif
@@ -0,0 +1,128 @@
+/**
+ * Work-Stealing Thread Pool
+ *
+ * Copyright (c) 2019, xehoth
+ * All rights reserved.
+ *
+ * Licensed under the MIT License;
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author xehoth
+ */
+#ifndef _WORK_STEALING_POOL_HPP_
+#define _WORK_STEALING_POOL_HPP_
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace HybridSort {
+
+    /**
+     * A thread pool in which every worker owns a queue of tasks.
+     *
+     * A worker pushes the tasks it spawns to the back of its own queue and
+     * runs them from the back, so it keeps working on the most recently split
+     * (and cache-hot) ranges. An idle worker steals from the front of
+     * another queue, where the oldest and largest tasks are.
+     */
+    class WorkStealingPool {
+     public:
+        /**
+         * A task receives the index of the worker running it, which is the
+         * worker its subtasks should be spawned on.
+         */
+        using Task = std::function<void(int)>;
+
+        explicit WorkStealingPool(int threads) : queues(threads), pending(0) {}
+
+        int threads() const {
+            return static_cast<int>(queues.size());
+        }
+
+        /**
+         * Adds a task to the queue of the given worker.
+         *
+         * @param worker the index of the worker
+         * @param task the task to run
+         */
+        void spawn(int worker, Task task) {
+            pending++;
+            std::lock_guard<std::mutex> lock(queues[worker].mutex);
+            queues[worker].tasks.push_back(std::move(task));
+        }
+
+        /**
+         * Runs the spawned tasks, and the tasks they spawn, until all of them
+         * are done. The calling thread is worker 0.
+         */
+        void run() {
+            std::vector<std::thread> pool;
+            pool.reserve(queues.size() - 1);
+            for (int t = 1; t < threads(); t++) pool.emplace_back(&WorkStealingPool::work, this, t);
+            work(0);
+            for (auto &thread : pool) thread.join();
+        }
+
+     private:
+        struct Queue {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        bool pop(int worker, Task &task) {
+            std::lock_guard<std::mutex> lock(queues[worker].mutex);
+            if (queues[worker].tasks.empty()) return false;
+            task = std::move(queues[worker].tasks.back());
+            queues[worker].tasks.pop_back();
+            return true;
+        }
+
+        bool steal(int worker, Task &task) {
+            for (int i = 1; i < threads(); i++) {
+                Queue &victim = queues[(worker + i) % threads()];
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                if (victim.tasks.empty()) continue;
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                return true;
+            }
+            return false;
+        }
+
+        void work(int worker) {
+            // A task is only counted as done after it has spawned its subtasks
+            while (pending > 0) {
+                Task task;
+                if (pop(worker, task) || steal(worker, task)) {
+                    task(worker);
+                    pending--;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        std::vector<Queue> queues;
+        std::atomic<int> pending;
+    };
+}  // namespace HybridSort
+#endif
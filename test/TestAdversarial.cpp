@@ -0,0 +1,72 @@
+/**
+ * Hrbrid Sort Test Adversarial
+ *
+ * Copyright (c) 2019, xehoth
+ * All rights reserved.
+ *
+ * Licensed under the MIT License;
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author xehoth
+ */
+#include <iostream>
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include "../HybridSort.hpp"
+#include "../include/AntiQuickSort.hpp"
+
+/**
+ * Lets McIlroy's adversary pick the keys while the guarded Dual-Pivot
+ * Quicksort runs, and checks that it still makes O(n log n) comparisons.
+ */
+void testComparisons(int n) {
+    HybridSort::AntiQuickSortAdversary adversary(n);
+    std::vector<HybridSort::AntiQuickSortKey> keys(n);
+    for (int i = 0; i < n; i++) keys[i] = {i, &adversary};
+    HybridSort::dualPivotQuickSort(keys.data(), 0, n - 1, true);
+    if (adversary.comparisons > 8 * n * std::log2(n)) {
+        std::cout << "failed on comparisons test, n = " << n << ": " << adversary.comparisons
+                  << " comparisons" << std::endl;
+        exit(0);
+    }
+}
+
+/**
+ * Sorts the inputs which make the unguarded sort quadratic.
+ */
+void testSort(int n) {
+    std::vector<int> a = HybridSort::antiQuickSort(n, INT_MAX);
+    std::vector<int> b = a, c = a;
+    HybridSort::dualPivotQuickSort(a.data(), 0, n - 1, true);
+    HybridSort::sort(b.begin(), b.end());
+    HybridSort::parallel_sort(c.begin(), c.end(), 4);
+    if (!std::is_sorted(a.begin(), a.end()) || !std::is_sorted(b.begin(), b.end()) ||
+        !std::is_sorted(c.begin(), c.end())) {
+        std::cout << "failed on sort test, n = " << n << std::endl;
+        exit(0);
+    }
+}
+
+int main() {
+    for (int n = 100; n <= 100000; n *= 10) testComparisons(n);
+    for (int n = 1000; n <= 20000; n *= 2) testSort(n);
+    std::cout << "all tests pass" << std::endl;
+}
@@ -0,0 +1,125 @@
+/**
+ * Hybrid Sort Test Arg Sort
+ *
+ * Copyright (c) 2019, xehoth
+ * All rights reserved.
+ *
+ * Licensed under the MIT License;
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author xehoth
+ */
+#include <iostream>
+#include <algorithm>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <vector>
+#include "../HybridSort.hpp"
+
+std::mt19937 gen;
+
+struct Row {
+    int key;
+    int payload;
+};
+
+struct RowLess {
+    bool operator()(const Row &x, const Row &y) const { return x.key < y.key; }
+};
+
+void fail(const char *name, int n) {
+    std::cout << "failed on " << name << " test, n = " << n << std::endl;
+    exit(0);
+}
+
+/**
+ * Returns the indices which sort the range stably in the order of the
+ * comparator.
+ */
+template <typename T, typename Comp>
+std::vector<int> expectedIndices(const std::vector<T> &a, Comp cmp) {
+    std::vector<int> idx(a.size());
+    std::iota(idx.begin(), idx.end(), 0);
+    std::stable_sort(idx.begin(), idx.end(), [&](int i, int j) { return cmp(a[i], a[j]); });
+    return idx;
+}
+
+/**
+ * Argsorts keys drawn from range values in both orders, into indices of
+ * several integer types.
+ */
+template <typename T>
+void testKeys(int n, unsigned int range) {
+    std::vector<T> a(n);
+    for (int i = 0; i < n; i++) {
+        a[i] = static_cast<T>(static_cast<int>(gen() % range) - 7);
+        // Zeros of both signs are equal, their indices stay in order
+        if (a[i] == 0 && gen() % 2 == 0) a[i] = -a[i];
+    }
+    const std::vector<T> original = a;
+
+    std::vector<int> idx(n);
+    HybridSort::argsort(a.begin(), a.end(), idx.begin());
+    if (idx != expectedIndices(a, std::less<T>())) fail("ascending", n);
+
+    HybridSort::argsort(a.begin(), a.end(), idx.begin(), std::greater<T>());
+    if (idx != expectedIndices(a, std::greater<T>())) fail("descending", n);
+
+    std::vector<long long> wide(n);
+    HybridSort::argsort(a.data(), a.data() + n, wide.data());
+    std::vector<int> expected = expectedIndices(a, std::less<T>());
+    if (!std::equal(wide.begin(), wide.end(), expected.begin())) fail("wide index", n);
+
+    if (a != original) fail("keys unchanged", n);
+}
+
+/**
+ * Argsorts rows by a comparator, as a vector and as a deque.
+ */
+void testRows(int n, int range) {
+    std::vector<Row> a(n);
+    for (int i = 0; i < n; i++) a[i] = {static_cast<int>(gen() % range), i};
+    std::vector<int> expected = expectedIndices(a, RowLess());
+
+    std::vector<int> idx(n);
+    HybridSort::argsort(a.begin(), a.end(), idx.begin(), RowLess());
+    if (idx != expected) fail("rows", n);
+
+    std::deque<Row> d(a.begin(), a.end());
+    std::deque<int> di(n);
+    HybridSort::argsort(d.begin(), d.end(), di.begin(), RowLess());
+    if (!std::equal(di.begin(), di.end(), expected.begin())) fail("deque", n);
+}
+
+int main() {
+    for (int n = 1; n <= 1000000; n = n * 3 + 1) {
+        testKeys<int>(n, 0xffffffff);
+        testKeys<int>(n, 16);
+        testKeys<unsigned char>(n, 256);
+        testKeys<long long>(n, n);
+        testKeys<double>(n, 0xffffffff);
+        testKeys<float>(n, 16);
+        testRows(n, 16);
+        testRows(n, n);
+    }
+    std::cout << "all tests pass" << std::endl;
+}
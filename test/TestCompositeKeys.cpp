@@ -0,0 +1,122 @@
+/**
+ * Test Composite Keys
+ *
+ * Copyright (c) 2019, xehoth
+ * All rights reserved.
+ *
+ * Licensed under the MIT License;
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author xehoth
+ */
+#include <iostream>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <random>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "../HybridSort.hpp"
+
+std::mt19937 gen;
+
+void fail(const char *name, int n) {
+    std::cout << "failed on " << name << " test, n = " << n << std::endl;
+    exit(0);
+}
+
+/**
+ * Returns a random value of type T below range, negative ones too if T is
+ * signed, and both zeros if T is floating-point.
+ */
+template <typename T>
+T randomField(unsigned int range) {
+    T x = static_cast<T>(gen() % range);
+    if (std::is_signed<T>::value && gen() % 2 == 0) x = static_cast<T>(-x);
+    return x;
+}
+
+template <typename A, typename B>
+void randomKey(std::pair<A, B> &x, unsigned int range) {
+    x = std::make_pair(randomField<A>(range), randomField<B>(range));
+}
+
+template <typename A, typename B, typename C>
+void randomKey(std::tuple<A, B, C> &x, unsigned int range) {
+    x = std::make_tuple(randomField<A>(range), randomField<B>(range), randomField<C>(range));
+}
+
+/**
+ * Sorts composite keys with fields drawn from range values in both orders,
+ * and checks every key is equivalent to the one std::sort puts there.
+ */
+template <typename T>
+void testKeys(const char *name, int n, unsigned int range) {
+    std::vector<T> a(n);
+    for (int i = 0; i < n; i++) randomKey(a[i], range);
+    std::vector<T> b = a, expected = a;
+    std::sort(expected.begin(), expected.end());
+    HybridSort::sort(b.begin(), b.end());
+    for (int i = 0; i < n; i++) {
+        if (b[i] < expected[i] || expected[i] < b[i]) fail(name, n);
+    }
+
+    b = a;
+    std::sort(expected.begin(), expected.end(), std::greater<T>());
+    HybridSort::sort(b.data(), b.data() + n, std::greater<T>());
+    for (int i = 0; i < n; i++) {
+        if (b[i] < expected[i] || expected[i] < b[i]) fail(name, n);
+    }
+
+    // Keys sorted with a few swaps are merged as runs
+    std::sort(b.begin(), b.end());
+    if (n > 1) std::swap(b[gen() % n], b[gen() % n]);
+    expected = b;
+    std::sort(expected.begin(), expected.end());
+    HybridSort::sort(b.begin(), b.end());
+    for (int i = 0; i < n; i++) {
+        if (b[i] < expected[i] || expected[i] < b[i]) fail(name, n);
+    }
+
+    std::deque<T> d(a.begin(), a.end());
+    HybridSort::sort(d.begin(), d.end());
+    if (!std::is_sorted(d.begin(), d.end())) fail(name, n);
+}
+
+template <typename T>
+void testKeys(const char *name, int n) {
+    testKeys<T>(name, n, 0xffffffff);
+    testKeys<T>(name, n, 4);
+}
+
+int main() {
+    for (int n = 1; n <= 1000000; n = n * 3 + 1) {
+        // Packed into one radix key
+        testKeys<std::pair<std::uint32_t, std::uint32_t> >("pair<uint32, uint32>", n);
+        testKeys<std::pair<int, float> >("pair<int, float>", n);
+        testKeys<std::tuple<char, short, int> >("tuple<char, short, int>", n);
+        // Sorted field by field
+        testKeys<std::pair<std::uint64_t, double> >("pair<uint64, double>", n);
+        testKeys<std::tuple<int, std::int64_t, float> >("tuple<int, int64, float>", n);
+    }
+    std::cout << "all tests pass" << std::endl;
+}
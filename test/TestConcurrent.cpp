@@ -0,0 +1,84 @@
+/**
+ * Hrbrid Sort Test Concurrent
+ *
+ * Copyright (c) 2019, xehoth
+ * All rights reserved.
+ *
+ * Licensed under the MIT License;
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author xehoth
+ */
+#include <iostream>
+#include <algorithm>
+#include <random>
+#include <functional>
+#include <thread>
+#include <atomic>
+#include <cstdlib>
+#include "../HybridSort.hpp"
+
+/**
+ * Sorts many independent arrays on many threads at the same time and
+ * compares every result with std::sort.
+ */
+template <typename T, typename Dist>
+void testConcurrent(const char *name, int threads, int rounds, int maxLength) {
+    std::atomic<bool> failed(false);
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; t++) {
+        pool.emplace_back([&, t]() {
+            std::mt19937_64 gen(t);
+            Dist dist;
+            for (int round = 0; round < rounds; round++) {
+                const int n = gen() % maxLength + 1;
+                std::vector<T> a(n);
+                for (int i = 0; i < n; i++) a[i] = dist(gen);
+                // Arrays made of a few sorted runs take the merge path of dual pivot quick sort
+                if (round % 2 == 1) {
+                    for (int i = 0; i < n; i += n / 8 + 1)
+                        std::sort(a.begin() + i, a.begin() + std::min(n, i + n / 8 + 1));
+                }
+                std::vector<T> b = a;
+                HybridSort::sort(a.begin(), a.end());
+                std::sort(b.begin(), b.end());
+                if (a != b) failed = true;
+            }
+        });
+    }
+    for (auto &thread : pool) thread.join();
+    if (failed) {
+        std::cout << "failed on concurrent " << name << " test" << std::endl;
+        exit(0);
+    }
+}
+
+int main() {
+    const int THREADS = 16;
+    testConcurrent<int, std::uniform_int_distribution<int> >("int", THREADS, 100, 1000);
+    testConcurrent<int, std::uniform_int_distribution<int> >("int", THREADS, 20, 100000);
+    testConcurrent<int, std::uniform_int_distribution<int> >("int", THREADS, 2, 4000000);
+    testConcurrent<unsigned short, std::uniform_int_distribution<unsigned short> >(
+        "unsigned short", THREADS, 2, 4000000);
+    testConcurrent<long long, std::uniform_int_distribution<long long> >("long long", THREADS,
+                                                                         20, 100000);
+    testConcurrent<double, std::uniform_real_distribution<double> >("double", THREADS, 20,
+                                                                    100000);
+    std::cout << "all tests pass" << std::endl;
+}
@@ -0,0 +1,112 @@
+/**
+ * Test Counting Sort
+ *
+ * Copyright (c) 2019, xehoth
+ * All rights reserved.
+ *
+ * Licensed under the MIT License;
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author xehoth
+ */
+#include <iostream>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <vector>
+#include "../HybridSort.hpp"
+
+std::mt19937 gen;
+
+enum class Status : short { OK = 200, NOT_FOUND = 404, ERROR = 500 };
+
+void fail(const char *name, int n) {
+    std::cout << "failed on " << name << " test, n = " << n << std::endl;
+    exit(0);
+}
+
+/**
+ * Sorts keys lo + [0, range) in both orders, in place and with the
+ * default memory, and checks them against std::sort.
+ */
+template <typename T>
+void testKeys(const char *name, int n, long long lo, unsigned long long range) {
+    std::vector<T> a(n);
+    for (int i = 0; i < n; i++) a[i] = static_cast<T>(lo + static_cast<long long>(gen() % range));
+    std::vector<T> b = a, expected = a;
+    std::sort(expected.begin(), expected.end());
+    HybridSort::sort(b.begin(), b.end());
+    if (b != expected) fail(name, n);
+
+    b = a;
+    HybridSort::sort(b.begin(), b.end(), HybridSort::BoundedMemory());
+    if (b != expected) fail(name, n);
+
+    b = a;
+    HybridSort::stable_sort(b.begin(), b.end());
+    if (b != expected) fail(name, n);
+
+    b = a;
+    std::reverse(expected.begin(), expected.end());
+    HybridSort::sort(b.data(), b.data() + n, std::greater<T>());
+    if (b != expected) fail(name, n);
+}
+
+void testStatus(int n) {
+    const Status codes[] = {Status::OK, Status::NOT_FOUND, Status::ERROR};
+    std::vector<Status> a(n);
+    for (int i = 0; i < n; i++) a[i] = codes[gen() % 3];
+    std::vector<Status> expected = a;
+    std::sort(expected.begin(), expected.end());
+    HybridSort::sort(a.begin(), a.end());
+    if (a != expected) fail("status", n);
+}
+
+/**
+ * Sorts narrow keys but one far away, which the sample misses, so only the
+ * exact range shows that they are too wide to be counted.
+ */
+void testOutlier(int n) {
+    std::vector<unsigned int> a(n);
+    for (int i = 0; i < n; i++) a[i] = gen() % 100;
+    if (n > 1) a[1] = 0xfffffff0u;
+    std::vector<unsigned int> expected = a;
+    std::sort(expected.begin(), expected.end());
+    HybridSort::sort(a.begin(), a.end());
+    if (a != expected) fail("outlier", n);
+}
+
+int main() {
+    for (int n = 1; n <= 1000000; n = n * 3 + 1) {
+        testKeys<signed char>("int8", n, -128, 256);
+        testKeys<unsigned char>("uint8", n, 0, 256);
+        testKeys<char>("char", n, 'a', 26);
+        testKeys<short>("int16", n, -32768, 65536);
+        testKeys<unsigned short>("uint16", n, 0, 65536);
+        testKeys<unsigned short>("narrow uint16", n, 60000, 100);
+        testKeys<int>("narrow int32", n, -500, 1000);
+        testKeys<int>("int32", n, -1000000000, 2000000000);
+        testKeys<long long>("narrow int64", n, 1000000000000LL, 1000);
+        testOutlier(n);
+        testStatus(n);
+    }
+    std::cout << "all tests pass" << std::endl;
+}
@@ -0,0 +1,106 @@
+/**
+ * Hybrid Sort Test Large
+ *
+ * Copyright (c) 2019, xehoth
+ * All rights reserved.
+ *
+ * Licensed under the MIT License;
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author xehoth
+ */
+#include <iostream>
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <vector>
+#include "../HybridSort.hpp"
+
+/**
+ * The length of the arrays, which doesn't fit in an int. The test needs
+ * a little more than 4 GiB of memory, as LSD radix sort takes a buffer
+ * as long as the array.
+ */
+const long long N = (1LL << 31) + 12345;
+
+void generate(std::vector<unsigned char> &a) {
+    std::mt19937_64 gen;
+    for (size_t i = 0; i < a.size(); i += 8) {
+        unsigned long long x = gen();
+        for (size_t j = i; j < i + 8 && j < a.size(); j++, x >>= 8) a[j] = x & 255;
+    }
+}
+
+std::vector<long long> histogram(const std::vector<unsigned char> &a) {
+    std::vector<long long> cnt(256);
+    for (unsigned char x : a) cnt[x]++;
+    return cnt;
+}
+
+/**
+ * Sorts the array by the function and checks that it is a sorted
+ * permutation of the input.
+ */
+template <typename Compare, typename Function>
+void testSort(std::vector<unsigned char> &a, Compare comp, Function sort, const char *name) {
+    generate(a);
+    std::vector<long long> cnt = histogram(a);
+    sort(a);
+    if (!std::is_sorted(a.begin(), a.end(), comp) || histogram(a) != cnt) {
+        std::cout << "failed on " << name << " test" << std::endl;
+        exit(0);
+    }
+}
+
+int main() {
+    std::vector<unsigned char> a(N);
+    // Sort counts bytes, so the radix sorts are called directly as well
+    testSort(a, std::less<unsigned char>(),
+             [](std::vector<unsigned char> &a) { HybridSort::sort(a.begin(), a.end()); },
+             "counting sort");
+    testSort(a, std::greater<unsigned char>(),
+             [](std::vector<unsigned char> &a) {
+                 HybridSort::sort(a.begin(), a.end(), std::greater<unsigned char>());
+             },
+             "descending counting sort");
+    testSort(a, std::less<unsigned char>(),
+             [](std::vector<unsigned char> &a) { HybridSort::radixSort(a.data(), a.size()); },
+             "radix sort");
+    testSort(a, std::greater<unsigned char>(),
+             [](std::vector<unsigned char> &a) {
+                 HybridSort::descendingRadixSort(a.data(), a.size());
+             },
+             "descending radix sort");
+    testSort(a, std::less<unsigned char>(),
+             [](std::vector<unsigned char> &a) { HybridSort::lsdRadixSort(a.data(), a.size()); },
+             "LSD radix sort");
+    testSort(a, std::less<unsigned char>(),
+             [](std::vector<unsigned char> &a) {
+                 HybridSort::vectorizedQuickSort(a.begin(), a.end());
+             },
+             "quick sort");
+    testSort(a, std::greater<unsigned char>(),
+             [](std::vector<unsigned char> &a) {
+                 HybridSort::vectorizedQuickSort(a.begin(), a.end(),
+                                                 std::greater<unsigned char>());
+             },
+             "descending quick sort");
+    std::cout << "all tests pass" << std::endl;
+}
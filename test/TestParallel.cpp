@@ -0,0 +1,104 @@
+/**
+ * Hrbrid Sort Test Parallel
+ *
+ * Copyright (c) 2019, xehoth
+ * All rights reserved.
+ *
+ * Licensed under the MIT License;
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author xehoth
+ */
+#include <iostream>
+#include <algorithm>
+#include <random>
+#include <functional>
+#include <cstdlib>
+#include <climits>
+#include "../HybridSort.hpp"
+
+template <typename T, typename Gen>
+void testParallel(Gen &gen, const char *name) {
+    static auto genN = std::bind(std::uniform_int_distribution<>(), std::mt19937());
+    const int n = genN() % 20000000 + 1;
+    const int threads = genN() % 16 + 1;
+    std::vector<T> a(n);
+    for (int i = 0; i < n; i++) a[i] = gen();
+    std::vector<T> b = a;
+    HybridSort::parallel_sort(a.begin(), a.end(), threads);
+    std::sort(b.begin(), b.end());
+    if (a != b) {
+        std::cout << "failed on parallel " << name << " test with " << threads << " threads"
+                  << std::endl;
+        exit(0);
+    }
+}
+
+void testInt() {
+    static auto gen = std::bind(std::uniform_int_distribution<int>(INT_MIN), std::mt19937());
+    testParallel<int>(gen, "int");
+}
+
+void testUint() {
+    static auto gen = std::bind(std::uniform_int_distribution<unsigned int>(), std::mt19937());
+    testParallel<unsigned int>(gen, "unsigned int");
+}
+
+void testLongLong() {
+    static auto gen = std::bind(std::uniform_int_distribution<long long>(), std::mt19937_64());
+    testParallel<long long>(gen, "long long");
+}
+
+void testDouble() {
+    static auto gen = std::bind(std::uniform_real_distribution<>(-1e9, 1e9), std::mt19937());
+    testParallel<double>(gen, "double");
+}
+
+void testLongDouble() {
+    static auto gen = std::bind(std::uniform_real_distribution<long double>(-1e9, 1e9),
+                                std::mt19937());
+    testParallel<long double>(gen, "long double");
+}
+
+void testQuickSort() {
+    static auto genN = std::bind(std::uniform_int_distribution<>(), std::mt19937());
+    static auto gen = std::bind(std::uniform_real_distribution<>(-1e9, 1e9), std::mt19937());
+    const int n = genN() % 4000000 + 1;
+    const int threads = genN() % 16 + 1;
+    std::vector<double> a(n);
+    // Few distinct values exercise the single pivot partitioning
+    for (int i = 0; i < n; i++) a[i] = i % 2 == 0 ? gen() : static_cast<int>(gen()) % 16;
+    std::vector<double> b = a;
+    HybridSort::parallelDualPivotQuickSort(a.data(), n, threads);
+    std::sort(b.begin(), b.end());
+    if (a != b) {
+        std::cout << "failed on parallel quick sort test with " << threads << " threads"
+                  << std::endl;
+        exit(0);
+    }
+}
+
+int main() {
+    const int TEST_CNT = 5;
+    std::vector<std::function<void()> > tests{testInt,    testUint,       testLongLong,
+                                              testDouble, testLongDouble, testQuickSort};
+    for (auto f : tests)
+        for (int i = 0; i < TEST_CNT; i++) f();
+    std::cout << "all tests pass" << std::endl;
+}
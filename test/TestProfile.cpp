@@ -0,0 +1,117 @@
+/**
+ * Hybrid Sort Test Profile
+ *
+ * Copyright (c) 2019, xehoth
+ * All rights reserved.
+ *
+ * Licensed under the MIT License;
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author xehoth
+ */
+#include <iostream>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <random>
+#include <vector>
+#include "../HybridSort.hpp"
+
+template <typename T>
+void testType(const char *name) {
+    static auto gen = std::bind(std::uniform_int_distribution<long long>(), std::mt19937_64());
+    for (int n = 1; n <= 100000; n *= 10) {
+        std::vector<T> a(n);
+        for (int i = 0; i < n; i++) a[i] = static_cast<T>(gen());
+        std::vector<T> b = a;
+        HybridSort::sort(a.begin(), a.end());
+        std::sort(b.begin(), b.end());
+        if (a != b) {
+            std::cout << "failed on " << name << " test, n = " << n << std::endl;
+            exit(0);
+        }
+    }
+}
+
+void testTypes() {
+    testType<unsigned char>("unsigned char");
+    testType<short>("short");
+    testType<int>("int");
+    testType<double>("double");
+}
+
+void writeProfile(const char *path, long long threshold) {
+    std::ofstream out(path);
+    out << "unknown_threshold 1\n";
+    for (int bits = 8; bits <= 64; bits <<= 1)
+        out << "radix_sort_threshold_" << bits << " " << threshold << "\n";
+}
+
+void checkProfile(long long threshold) {
+    for (int i = 0; i < 4; i++) {
+        if (HybridSort::profile().radixSortThreshold[i] != threshold) {
+            std::cout << "failed on profile test, threshold = " << threshold << std::endl;
+            exit(0);
+        }
+    }
+}
+
+/**
+ * Checks that the profile named by HYBRID_SORT_PROFILE is loaded when the
+ * profile is first used.
+ */
+void testStartup() {
+    const char *path = "TestProfileStartup.txt";
+    writeProfile(path, 12345);
+    setenv("HYBRID_SORT_PROFILE", path, 1);
+    checkProfile(12345);
+    std::remove(path);
+}
+
+/**
+ * Loads a profile which sets the radix sort thresholds of all key sizes
+ * to the given value, and checks that it is in use.
+ */
+void testLoad(long long threshold) {
+    const char *path = "TestProfile.txt";
+    writeProfile(path, threshold);
+    bool loaded = HybridSort::loadProfile(path);
+    std::remove(path);
+    if (!loaded) {
+        std::cout << "failed on load test" << std::endl;
+        exit(0);
+    }
+    checkProfile(threshold);
+}
+
+int main() {
+    testStartup();
+    if (HybridSort::loadProfile("no/such/profile.txt")) {
+        std::cout << "failed on missing profile test" << std::endl;
+        exit(0);
+    }
+    // Always radix sort, then never radix sort
+    testLoad(0);
+    testTypes();
+    testLoad(1LL << 40);
+    testTypes();
+    std::cout << "all tests pass" << std::endl;
+}
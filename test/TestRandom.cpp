@@ -30,6 +30,11 @@
 #include <random>
 #include <functional>
 #include <cstdlib>
+#include <climits>
+#include <cmath>
+#include <array>
+#include <string>
+#include <memory>
 #include "../HybridSort.hpp"
 
 void testInt() {
@@ -44,6 +49,19 @@ void testInt() {
     }
 }
 
+void testIntBounded() {
+    static auto genN = std::bind(std::uniform_int_distribution<>(), std::mt19937());
+    static auto gen = std::bind(std::uniform_int_distribution<int>(INT_MIN), std::mt19937());
+    const int n = genN() % 20000000 + 1;
+    std::vector<int> a(n);
+    for (int i = 0; i < n; i++) a[i] = gen();
+    HybridSort::sort(a.begin(), a.end(), HybridSort::BoundedMemory());
+    if (!std::is_sorted(a.begin(), a.end())) {
+        std::cout << "failed on bounded memory int test" << std::endl;
+        exit(0);
+    }
+}
+
 void testUint() {
     static auto gen = std::bind(std::uniform_int_distribution<unsigned int>(), std::mt19937());
     const int n = gen() % 20000000 + 1;
@@ -56,6 +74,32 @@ void testUint() {
     }
 }
 
+void testIntSigned() {
+    static auto genN = std::bind(std::uniform_int_distribution<>(), std::mt19937());
+    static auto gen = std::bind(std::uniform_int_distribution<int>(INT_MIN), std::mt19937());
+    const int n = genN() % 20000000 + 1;
+    std::vector<int> a(n);
+    for (int i = 0; i < n; i++) a[i] = gen();
+    HybridSort::sort(a.begin(), a.end());
+    if (!std::is_sorted(a.begin(), a.end())) {
+        std::cout << "failed on signed int test" << std::endl;
+        exit(0);
+    }
+}
+
+void testUintNarrow() {
+    static auto genN = std::bind(std::uniform_int_distribution<>(), std::mt19937());
+    static auto gen = std::bind(std::uniform_int_distribution<unsigned int>(), std::mt19937());
+    const int n = genN() % 20000000 + 1;
+    std::vector<unsigned int> a(n);
+    for (int i = 0; i < n; i++) a[i] = 0x5d000000u | (gen() & 0xff00ffu);
+    HybridSort::sort(a.begin(), a.end());
+    if (!std::is_sorted(a.begin(), a.end())) {
+        std::cout << "failed on narrow unsigned int test" << std::endl;
+        exit(0);
+    }
+}
+
 void testChar() {
     static auto gen = std::bind(std::uniform_int_distribution<char>(), std::mt19937());
     const int n = gen() % 20000000 + 1;
@@ -92,6 +136,26 @@ void testLongLong() {
     }
 }
 
+void testLongLongFullRange() {
+    static auto gen =
+        std::bind(std::uniform_int_distribution<long long>(LLONG_MIN), std::mt19937_64());
+    // Longer than the radix sort threshold, so the sign bit is sorted by radix sort
+    const int n = 4194304 + static_cast<int>(gen() & 0x3fffff) + 1;
+    std::vector<long long> a(n);
+    for (int i = 0; i < n; i++) a[i] = gen();
+    a[gen() & 0x3fffff] = LLONG_MIN;
+    a[gen() & 0x3fffff] = LLONG_MAX;
+    a[gen() & 0x3fffff] = 0;
+    a[gen() & 0x3fffff] = -1;
+    std::vector<long long> b = a;
+    HybridSort::sort(a.begin(), a.end());
+    std::sort(b.begin(), b.end());
+    if (a != b) {
+        std::cout << "failed on full range long long test" << std::endl;
+        exit(0);
+    }
+}
+
 void testUlongLong() {
     static auto gen =
         std::bind(std::uniform_int_distribution<unsigned long long>(), std::mt19937_64());
@@ -118,6 +182,19 @@ void testDouble() {
     }
 }
 
+void testDoubleSigned() {
+    static auto genN = std::bind(std::uniform_int_distribution<>(), std::mt19937());
+    static auto gen = std::bind(std::uniform_real_distribution<>(-1e9, 1e9), std::mt19937());
+    const int n = genN() % 20000000 + 1;
+    std::vector<double> a(n);
+    for (int i = 0; i < n; i++) a[i] = i % 16 == 0 ? (i % 32 == 0 ? 0.0 : -0.0) : gen();
+    HybridSort::sort(a.begin(), a.end());
+    if (!std::is_sorted(a.begin(), a.end())) {
+        std::cout << "failed on signed double test" << std::endl;
+        exit(0);
+    }
+}
+
 void testFloat() {
     static auto genN = std::bind(std::uniform_int_distribution<>(), std::mt19937());
     static auto gen = std::bind(std::uniform_real_distribution<float>(), std::mt19937());
@@ -131,10 +208,239 @@ void testFloat() {
     }
 }
 
+void testSorter() {
+    static auto gen = std::bind(std::uniform_int_distribution<int>(INT_MIN), std::mt19937());
+    HybridSort::Sorter<int> sorter;
+    for (int k = 0; k < 8; k++) {
+        const int n = (gen() & 0x7fffffff) % (1000 << (k * 2)) + 1;
+        std::vector<int> a(n);
+        for (int i = 0; i < n; i++) a[i] = gen();
+        // Arrays made of a few sorted runs take the merge path of dual pivot quick sort
+        if (k % 2 == 1) {
+            for (int i = 0; i < n; i += n / 4 + 1)
+                std::sort(a.begin() + i, a.begin() + std::min(n, i + n / 4 + 1));
+        }
+        sorter.sort(a.begin(), a.end());
+        if (!std::is_sorted(a.begin(), a.end())) {
+            std::cout << "failed on sorter test" << std::endl;
+            exit(0);
+        }
+    }
+
+    // Long arrays of 16-bit keys are always counted and need no workspace
+    HybridSort::Sorter<unsigned short> shortSorter;
+    const int n = (gen() & 0x7fffffff) % 1000000 + 65536;
+    std::vector<unsigned short> b(n);
+    for (int i = 0; i < n; i++) b[i] = static_cast<unsigned short>(gen());
+    std::vector<unsigned short> c = b;
+    shortSorter.sort(b.begin(), b.end());
+    std::sort(c.begin(), c.end());
+    if (b != c || HybridSort::Sorter<unsigned short>::scratchSize(n) != 0) {
+        std::cout << "failed on counting sorter test" << std::endl;
+        exit(0);
+    }
+}
+
+void testBranchPartition() {
+    static auto gen = std::bind(std::uniform_int_distribution<int>(INT_MIN), std::mt19937());
+    for (int k = 0; k < 4; k++) {
+        const int n = (gen() & 0x7fffffff) % 2000000 + 1;
+        // Few distinct values exercise the equal pivots and center part paths
+        const int mask = k % 2 == 0 ? -1 : 0xff;
+        std::vector<double> a(n);
+        for (int i = 0; i < n; i++) a[i] = gen() & mask;
+        HybridSort::dualPivotQuickSort<double, HybridSort::BranchPartition>(a.data(), 0, n - 1,
+                                                                              true);
+        if (!std::is_sorted(a.begin(), a.end())) {
+            std::cout << "failed on branch partition test" << std::endl;
+            exit(0);
+        }
+    }
+}
+
+template <typename T>
+void testVectorizedType(const char *name) {
+    static auto gen =
+        std::bind(std::uniform_int_distribution<long long>(LLONG_MIN), std::mt19937_64());
+    for (int level = HybridSort::SIMD_SCALAR; level <= HybridSort::simdLevel(); level++) {
+        const int n = (gen() & 0x7fffffff) % 2000000 + 1;
+        // Low entropy keys exercise the split of elements equal to the pivot
+        const long long mask = gen() % 2 ? -1 : 0xff;
+        std::vector<T> a(n);
+        for (int i = 0; i < n; i++) a[i] = static_cast<T>(gen() & mask);
+        HybridSort::vectorizedQuickSort(a.data(), 0, n - 1, level);
+        if (!std::is_sorted(a.begin(), a.end())) {
+            std::cout << "failed on vectorized " << name << " test" << std::endl;
+            exit(0);
+        }
+    }
+}
+
+void testVectorized() {
+    testVectorizedType<int>("int");
+    testVectorizedType<unsigned int>("unsigned int");
+    testVectorizedType<float>("float");
+    testVectorizedType<long long>("long long");
+    testVectorizedType<unsigned long long>("unsigned long long");
+    testVectorizedType<double>("double");
+}
+
+void testTiny() {
+    static auto gen = std::bind(std::uniform_int_distribution<int>(-50, 50), std::mt19937());
+    for (int n = 0; n <= 64; n++) {
+        std::vector<int> a(n);
+        std::vector<double> b(n);
+        for (int i = 0; i < n; i++) a[i] = gen();
+        // Signed zeros must come out as they went in
+        for (int i = 0; i < n; i++) b[i] = gen() == 0 ? -0.0 : a[i] / 4.0;
+        std::vector<int> c = a;
+        std::vector<double> d = b;
+        HybridSort::sort(a.begin(), a.end());
+        HybridSort::sort(b.begin(), b.end());
+        std::sort(c.begin(), c.end());
+        std::sort(d.begin(), d.end());
+        auto negative = [](double x) { return std::signbit(x); };
+        bool sameZeros = std::count_if(b.begin(), b.end(), negative) ==
+                         std::count_if(d.begin(), d.end(), negative);
+        if (a != c || b != d || !sameZeros) {
+            std::cout << "failed on tiny test" << std::endl;
+            exit(0);
+        }
+    }
+}
+
+template <typename T>
+void testDescendingType(const char *name) {
+    static auto gen =
+        std::bind(std::uniform_int_distribution<long long>(LLONG_MIN), std::mt19937_64());
+    // Long enough to reach radix sort for every key size
+    const int n = (gen() & 0x7fffffff) % 5000000 + 1;
+    const long long mask = gen() % 2 ? -1 : 0xff;
+    std::vector<T> a(n);
+    for (int i = 0; i < n; i++) a[i] = static_cast<T>(gen() & mask);
+    // Ascending input is a single run which has to be reversed
+    if (gen() % 4 == 0) std::sort(a.begin(), a.end());
+    std::vector<T> b = a;
+    HybridSort::sort(a.begin(), a.end(), std::greater<T>());
+    std::sort(b.begin(), b.end(), std::greater<T>());
+    if (a != b) {
+        std::cout << "failed on descending " << name << " test" << std::endl;
+        exit(0);
+    }
+}
+
+void testComparator() {
+    testDescendingType<unsigned char>("unsigned char");
+    testDescendingType<int>("int");
+    testDescendingType<long long>("long long");
+    testDescendingType<float>("float");
+    testDescendingType<double>("double");
+
+    // Other comparators are sorted by Dual-Pivot Quicksort
+    static auto gen = std::bind(std::uniform_int_distribution<int>(-1000000, 1000000),
+                                std::mt19937());
+    const int n = (gen() & 0x7fffffff) % 2000000 + 1;
+    std::vector<int> a(n);
+    for (int i = 0; i < n; i++) a[i] = gen();
+    std::vector<int> b = a;
+    auto byAbs = [](int x, int y) { return std::abs(x) < std::abs(y); };
+    HybridSort::sort(a.begin(), a.end(), byAbs);
+    std::sort(b.begin(), b.end());
+    std::vector<int> c = a;
+    std::sort(c.begin(), c.end());
+    if (!std::is_sorted(a.begin(), a.end(), byAbs) || b != c) {
+        std::cout << "failed on comparator test" << std::endl;
+        exit(0);
+    }
+}
+
+/**
+ * An element which has no default constructor.
+ */
+struct Point {
+    explicit Point(int x) : x(x) {}
+    int x;
+};
+
+void testComparatorTypes() {
+    // Elements Dual-Pivot Quicksort cannot copy or create are sorted by std::sort
+    static auto gen = std::bind(std::uniform_int_distribution<int>(), std::mt19937());
+    const int n = gen() % 200000 + 1;
+    std::vector<std::unique_ptr<int> > a;
+    std::vector<Point> b;
+    std::vector<int> c(n);
+    for (int i = 0; i < n; i++) {
+        c[i] = gen() % 1000;
+        a.emplace_back(new int(c[i]));
+        b.emplace_back(c[i]);
+    }
+    std::sort(c.begin(), c.end());
+    HybridSort::sort(a.begin(), a.end(),
+                     [](const std::unique_ptr<int> &x, const std::unique_ptr<int> &y) {
+                         return *x < *y;
+                     });
+    HybridSort::sort(b.begin(), b.end(), [](const Point &p, const Point &q) { return p.x < q.x; });
+    for (int i = 0; i < n; i++) {
+        if (*a[i] != c[i] || b[i].x != c[i]) {
+            std::cout << "failed on comparator types test" << std::endl;
+            exit(0);
+        }
+    }
+}
+
+enum class Level : long long { LOW = -1, HIGH = 1 };
+
+template <typename T>
+void testType(const char *name) {
+    static auto gen =
+        std::bind(std::uniform_int_distribution<long long>(LLONG_MIN), std::mt19937_64());
+    const int n = (gen() & 0x7fffffff) % 5000000 + 1;
+    std::vector<T> a(n);
+    for (int i = 0; i < n; i++) a[i] = static_cast<T>(gen());
+    std::vector<T> b = a;
+    HybridSort::sort(a.begin(), a.end());
+    std::sort(b.begin(), b.end());
+    if (a != b) {
+        std::cout << "failed on " << name << " test" << std::endl;
+        exit(0);
+    }
+}
+
+void testTypes() {
+    testType<signed char>("signed char");
+    testType<long>("long");
+    testType<unsigned long>("unsigned long");
+    testType<wchar_t>("wchar_t");
+    testType<char16_t>("char16_t");
+    testType<char32_t>("char32_t");
+    testType<Level>("enum");
+
+    static_assert(HybridSort::IsContiguousIterator<std::array<int, 4>::iterator>::value &&
+                      HybridSort::IsContiguousIterator<std::string::iterator>::value &&
+                      !HybridSort::IsContiguousIterator<std::vector<bool>::iterator>::value,
+                  "contiguous iterators");
+    static auto gen = std::bind(std::uniform_int_distribution<int>(), std::mt19937());
+    std::array<long, 1000> a;
+    for (long &x : a) x = gen();
+    std::string s(gen() % 100000, ' ');
+    for (char &c : s) c = static_cast<char>(gen());
+    HybridSort::sort(a.begin(), a.end());
+    HybridSort::sort(s.begin(), s.end());
+    if (!std::is_sorted(a.begin(), a.end()) || !std::is_sorted(s.begin(), s.end())) {
+        std::cout << "failed on contiguous iterator test" << std::endl;
+        exit(0);
+    }
+}
+
 int main() {
     const int TEST_CNT = 10;
-    std::vector<std::function<void()> > tests{testInt,      testUint,      testChar,   testUchar,
-                                              testLongLong, testUlongLong, testDouble, testFloat};
+    std::vector<std::function<void()> > tests{testInt,    testIntSigned,       testIntBounded,
+                                              testUint,   testUintNarrow,      testChar,
+                                              testUchar,  testLongLong,        testUlongLong,
+                                              testDouble, testDoubleSigned,    testFloat,
+                                              testSorter, testBranchPartition, testVectorized,
+                                              testTiny,   testComparator,      testTypes,
+                                              testComparatorTypes, testLongLongFullRange};
     for (auto f : tests)
         for (int i = 0; i < TEST_CNT; i++) f();
     std::cout << "all tests pass" << std::endl;
@@ -0,0 +1,137 @@
+/**
+ * Hybrid Sort Test Runs
+ *
+ * Copyright (c) 2019, xehoth
+ * All rights reserved.
+ *
+ * Licensed under the MIT License;
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author xehoth
+ */
+#include <iostream>
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+#include "../HybridSort.hpp"
+
+std::mt19937 gen;
+
+/**
+ * Returns n keys made of k runs, ascending or descending at random. The
+ * keys are random in [0, range), or increase with their index with the
+ * given jitter, like sorted batches of timestamps.
+ */
+std::vector<int> runs(int n, int k, int range, int jitter) {
+    std::vector<int> a(n);
+    for (int i = 0; i < n; i++)
+        a[i] = jitter > 0 ? i + static_cast<int>(gen() % jitter) : static_cast<int>(gen() % range);
+    for (int i = 0; i < k; i++) {
+        auto begin = a.begin() + static_cast<long long>(n) * i / k;
+        auto end = a.begin() + static_cast<long long>(n) * (i + 1) / k;
+        if (gen() % 4 == 0) {
+            std::sort(begin, end, std::greater<int>());
+        } else {
+            std::sort(begin, end);
+        }
+    }
+    return a;
+}
+
+void check(const std::vector<int> &a, const std::vector<int> &b, const char *name, int n, int k) {
+    if (a != b) {
+        std::cout << "failed on " << name << " test, n = " << n << ", k = " << k << std::endl;
+        exit(0);
+    }
+}
+
+/**
+ * Sorts k-run arrays, which are merged if they have few runs or the runs
+ * hardly overlap, and sorted by Quicksort or radix sort otherwise.
+ */
+void testSort(int n, int k, int range, int jitter) {
+    std::vector<int> a = runs(n, k, range, jitter);
+    std::vector<int> expected = a;
+    std::sort(expected.begin(), expected.end());
+
+    std::vector<int> b = a;
+    HybridSort::sort(b.begin(), b.end());
+    check(b, expected, "sort", n, k);
+
+    b = a;
+    HybridSort::Sorter<int>().sort(b.begin(), b.end());
+    check(b, expected, "sorter", n, k);
+
+    b = a;
+    HybridSort::sort(b.begin(), b.end(), std::greater<int>());
+    std::reverse(b.begin(), b.end());
+    check(b, expected, "descending", n, k);
+}
+
+struct Record {
+    int key;
+    int index;
+};
+
+struct RecordLess {
+    bool operator()(const Record &x, const Record &y) const { return x.key < y.key; }
+};
+
+/**
+ * Merges k runs of records with few distinct keys, and checks that records
+ * with equal keys keep their order.
+ */
+void testStability(int n, int k) {
+    std::vector<Record> a(n);
+    for (int i = 0; i < n; i++) a[i].key = static_cast<int>(gen() % 16);
+    for (int i = 0; i < k; i++) {
+        std::sort(a.begin() + static_cast<long long>(n) * i / k,
+                  a.begin() + static_cast<long long>(n) * (i + 1) / k, RecordLess());
+    }
+    for (int i = 0; i < n; i++) a[i].index = i;
+    std::vector<Record> expected = a;
+    std::stable_sort(expected.begin(), expected.end(), RecordLess());
+
+    HybridSort::mergeRuns(a.data(), 0, n - 1, (Record *) nullptr, 0, 0, 0, RecordLess(),
+                          std::numeric_limits<HybridSort::Index>::max());
+    for (int i = 0; i < n; i++) {
+        if (a[i].key != expected[i].key || a[i].index != expected[i].index) {
+            std::cout << "failed on stability test, n = " << n << ", k = " << k << std::endl;
+            exit(0);
+        }
+    }
+}
+
+int main() {
+    for (int n : {1000, 100000, 3000000}) {
+        for (int k = 2; k <= 100000 && k <= n; k *= 5) {
+            testSort(n, k, 1 << 30, 0);
+            testSort(n, k, 4, 0);
+            testSort(n, k, 0, n / k / 32 + 1);
+            testSort(n, k, 0, 2 * n / k);
+        }
+    }
+    for (int n = 1; n <= 100000; n = n * 3 + 1) {
+        for (int k = 1; k <= n; k = k * 4 + 1) testStability(n, k);
+    }
+    std::cout << "all tests pass" << std::endl;
+}
@@ -0,0 +1,182 @@
+/**
+ * Hybrid Sort Test Select
+ *
+ * Copyright (c) 2019, xehoth
+ * All rights reserved.
+ *
+ * Licensed under the MIT License;
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author xehoth
+ */
+#include <iostream>
+#include <algorithm>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+#include "../HybridSort.hpp"
+
+std::mt19937 gen;
+
+struct Player {
+    int score;
+    int id;
+};
+
+struct ScoreLess {
+    bool operator()(const Player &x, const Player &y) const { return x.score < y.score; }
+};
+
+void fail(const char *name, int n) {
+    std::cout << "failed on " << name << " test, n = " << n << std::endl;
+    exit(0);
+}
+
+/**
+ * Checks that a holds the elements of sorted, with the k-th one in place,
+ * none before it greater and none after it less.
+ */
+template <typename T, typename Comp>
+bool selected(std::vector<T> a, const std::vector<T> &sorted, int k, Comp cmp) {
+    const int n = static_cast<int>(a.size());
+    if (k < n) {
+        if (cmp(a[k], sorted[k]) || cmp(sorted[k], a[k])) return false;
+        for (int i = 0; i < k; i++)
+            if (cmp(a[k], a[i])) return false;
+        for (int i = k + 1; i < n; i++)
+            if (cmp(a[i], a[k])) return false;
+    }
+    std::sort(a.begin(), a.end(), cmp);
+    return a == sorted;
+}
+
+/**
+ * Selects the first, the median, the last and a random element of keys
+ * drawn from range values in both orders, and lists the smallest and the
+ * largest few of them.
+ */
+template <typename T>
+void testKeys(int n, unsigned int range) {
+    std::vector<T> a(n);
+    for (int i = 0; i < n; i++) a[i] = static_cast<T>(static_cast<int>(gen() % range) - 7);
+    std::vector<T> ascending = a, descending = a;
+    std::sort(ascending.begin(), ascending.end());
+    std::sort(descending.begin(), descending.end(), std::greater<T>());
+
+    const int ks[] = {0, n / 2, n - 1, static_cast<int>(gen() % n)};
+    for (int k : ks) {
+        std::vector<T> b = a;
+        HybridSort::nth_element(b.begin(), b.begin() + k, b.end());
+        if (!selected(b, ascending, k, std::less<T>())) fail("nth_element", n);
+
+        b = a;
+        HybridSort::nth_element(b.begin(), b.begin() + k, b.end(), std::greater<T>());
+        if (!selected(b, descending, k, std::greater<T>())) fail("descending nth_element", n);
+
+        b = a;
+        HybridSort::partial_sort(b.begin(), b.begin() + k, b.end());
+        if (!std::equal(b.begin(), b.begin() + k, ascending.begin()))
+            fail("partial_sort", n);
+
+        b = a;
+        auto end = HybridSort::top_k(b.begin(), b.end(), k);
+        if (end != b.begin() + k || !std::equal(b.begin(), end, descending.begin()))
+            fail("top_k", n);
+    }
+
+    std::vector<T> b = a;
+    if (HybridSort::top_k(b.begin(), b.end(), n + 1) != b.end() || b != descending)
+        fail("top_k all", n);
+}
+
+/**
+ * Lists the best players of a leaderboard, as a vector and as a deque.
+ */
+void testPlayers(int n) {
+    std::vector<Player> a(n);
+    for (int i = 0; i < n; i++) a[i] = {static_cast<int>(gen() % 1000), i};
+    std::vector<Player> expected = a;
+    std::sort(expected.begin(), expected.end(),
+              [](const Player &x, const Player &y) { return x.score > y.score; });
+    const int k = std::min(n, 100);
+
+    std::vector<Player> b = a;
+    HybridSort::top_k(b.begin(), b.end(), k, ScoreLess());
+    for (int i = 0; i < k; i++) {
+        if (b[i].score != expected[i].score) fail("players", n);
+    }
+
+    std::deque<Player> d(a.begin(), a.end());
+    HybridSort::top_k(d.begin(), d.end(), k, ScoreLess());
+    for (int i = 0; i < k; i++) {
+        if (d[i].score != expected[i].score) fail("deque", n);
+    }
+
+    b = a;
+    HybridSort::nth_element(b.begin(), b.begin() + n / 2, b.end(), ScoreLess());
+    if (b[n / 2].score != expected[n - 1 - n / 2].score) fail("median player", n);
+}
+
+/**
+ * Selects from scores owned by unique pointers, which can only be moved,
+ * so they are left to the standard algorithms.
+ */
+void testMoveOnly(int n) {
+    std::vector<std::unique_ptr<int> > a;
+    std::vector<int> expected(n);
+    for (int i = 0; i < n; i++) {
+        expected[i] = static_cast<int>(gen() % 1000);
+        a.emplace_back(new int(expected[i]));
+    }
+    std::sort(expected.begin(), expected.end());
+    auto less = [](const std::unique_ptr<int> &x, const std::unique_ptr<int> &y) {
+        return *x < *y;
+    };
+    const int k = std::min(n, 100);
+
+    HybridSort::nth_element(a.begin(), a.begin() + n / 2, a.end(), less);
+    if (*a[n / 2] != expected[n / 2]) fail("move-only median", n);
+
+    HybridSort::partial_sort(a.begin(), a.begin() + k, a.end(), less);
+    for (int i = 0; i < k; i++) {
+        if (*a[i] != expected[i]) fail("move-only partial sort", n);
+    }
+
+    HybridSort::top_k(a.begin(), a.end(), k, less);
+    for (int i = 0; i < k; i++) {
+        if (*a[i] != expected[n - 1 - i]) fail("move-only top k", n);
+    }
+}
+
+int main() {
+    for (int n = 1; n <= 1000000; n = n * 3 + 1) {
+        testKeys<int>(n, 0xffffffff);
+        testKeys<int>(n, 16);
+        testKeys<unsigned char>(n, 256);
+        testKeys<long long>(n, n);
+        testKeys<double>(n, 0xffffffff);
+        testKeys<float>(n, 16);
+        testPlayers(n);
+        testMoveOnly(n);
+    }
+    std::cout << "all tests pass" << std::endl;
+}
@@ -0,0 +1,129 @@
+/**
+ * Hybrid Sort Test Sort By Key
+ *
+ * Copyright (c) 2019, xehoth
+ * All rights reserved.
+ *
+ * Licensed under the MIT License;
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author xehoth
+ */
+#include <iostream>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+#include "../HybridSort.hpp"
+
+std::mt19937 gen;
+
+struct Record {
+    std::uint64_t ts;
+    std::uint32_t id;
+    float score;
+    char payload[16];
+};
+
+struct Named {
+    std::string name;
+    int id;
+};
+
+void fail(const char *name, int n) {
+    std::cout << "failed on " << name << " test, n = " << n << std::endl;
+    exit(0);
+}
+
+/**
+ * Checks that the records are those of expected in the same order.
+ */
+template <typename C>
+bool sameIds(const C &a, const std::vector<Record> &expected) {
+    for (size_t i = 0; i < expected.size(); i++) {
+        if (a[i].id != expected[i].id || a[i].payload[0] != expected[i].payload[0]) return false;
+    }
+    return true;
+}
+
+/**
+ * Sorts records by each of their fields in both orders, with keys drawn
+ * from range values, and checks that records of equal keys keep their order.
+ */
+void testRecords(int n, unsigned int range) {
+    std::vector<Record> a(n);
+    for (int i = 0; i < n; i++) {
+        a[i].ts = gen() % range * 1000000007ULL;
+        a[i].id = static_cast<std::uint32_t>(i);
+        a[i].score = static_cast<float>(static_cast<int>(gen() % range) - 7) / 4;
+        // Zeros of both signs are equal, their records stay in order
+        if (a[i].score == 0 && gen() % 2 == 0) a[i].score = -a[i].score;
+        a[i].payload[0] = static_cast<char>(i);
+    }
+    auto ts = [](const Record &r) { return r.ts; };
+    auto score = [](const Record &r) { return r.score; };
+
+    std::vector<Record> b = a, expected = a;
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](const Record &x, const Record &y) { return x.ts < y.ts; });
+    HybridSort::sort_by_key(b.begin(), b.end(), ts);
+    if (!sameIds(b, expected)) fail("ascending ts", n);
+
+    b = a;
+    expected = a;
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](const Record &x, const Record &y) { return x.score > y.score; });
+    HybridSort::sort_by_key(b.data(), b.data() + n, score, std::greater<float>());
+    if (!sameIds(b, expected)) fail("descending score", n);
+
+    std::deque<Record> d(a.begin(), a.end());
+    expected = a;
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](const Record &x, const Record &y) { return x.score < y.score; });
+    HybridSort::sort_by_key(d.begin(), d.end(), score);
+    if (!sameIds(d, expected)) fail("deque", n);
+}
+
+/**
+ * Sorts records by a string key, which has no radix key.
+ */
+void testNames(int n) {
+    std::vector<Named> a(n);
+    for (int i = 0; i < n; i++) a[i] = {std::to_string(gen() % 100), i};
+    std::vector<Named> expected = a;
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](const Named &x, const Named &y) { return x.name < y.name; });
+    HybridSort::sort_by_key(a.begin(), a.end(), [](const Named &x) { return x.name; });
+    for (int i = 0; i < n; i++) {
+        if (a[i].id != expected[i].id) fail("names", n);
+    }
+}
+
+int main() {
+    for (int n = 1; n <= 1000000; n = n * 3 + 1) {
+        testRecords(n, 0xffffffff);
+        testRecords(n, 16);
+        testNames(std::min(n, 100000));
+    }
+    std::cout << "all tests pass" << std::endl;
+}
@@ -0,0 +1,145 @@
+/**
+ * Test Sort Pairs
+ *
+ * Copyright (c) 2019, xehoth
+ * All rights reserved.
+ *
+ * Licensed under the MIT License;
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author xehoth
+ */
+#include <iostream>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "../HybridSort.hpp"
+
+std::mt19937 gen;
+
+void fail(const char *name, int n) {
+    std::cout << "failed on " << name << " test, n = " << n << std::endl;
+    exit(0);
+}
+
+/**
+ * Checks that the keys are sorted as expected, and that every value is
+ * the index of its key in the original keys, each index appearing once.
+ */
+template <typename C, typename K, typename Compare>
+bool check(const C &keys, const std::vector<K> &original, const std::vector<std::uint32_t> &values,
+           Compare comp) {
+    std::vector<K> expected = original;
+    std::sort(expected.begin(), expected.end(), comp);
+    std::vector<bool> seen(original.size());
+    for (size_t i = 0; i < original.size(); i++) {
+        if (comp(keys[i], expected[i]) || comp(expected[i], keys[i])) return false;
+        if (values[i] >= original.size() || seen[values[i]]) return false;
+        seen[values[i]] = true;
+        if (comp(keys[i], original[values[i]]) || comp(original[values[i]], keys[i])) return false;
+    }
+    return true;
+}
+
+std::vector<std::uint32_t> indices(int n) {
+    std::vector<std::uint32_t> values(n);
+    for (int i = 0; i < n; i++) values[i] = static_cast<std::uint32_t>(i);
+    return values;
+}
+
+/**
+ * Sorts keys drawn from range values with their original indices as values.
+ */
+void testPairs(int n, unsigned int range) {
+    std::vector<std::uint32_t> u(n);
+    for (int i = 0; i < n; i++) u[i] = static_cast<std::uint32_t>(gen() % range);
+    std::vector<std::uint32_t> keys = u, values = indices(n);
+    HybridSort::sort_pairs(keys.begin(), keys.end(), values.begin());
+    if (!check(keys, u, values, std::less<std::uint32_t>())) fail("ascending uint32", n);
+
+    std::vector<double> d(n);
+    for (int i = 0; i < n; i++) d[i] = static_cast<double>(static_cast<int>(gen() % range)) - 7.5;
+    std::vector<double> doubles = d;
+    values = indices(n);
+    HybridSort::sort_pairs(doubles.data(), doubles.data() + n, values.data(),
+                           std::greater<double>());
+    if (!check(doubles, d, values, std::greater<double>())) fail("descending double", n);
+
+    std::deque<std::uint32_t> dq(u.begin(), u.end());
+    values = indices(n);
+    HybridSort::sort_pairs(dq.begin(), dq.end(), values.begin());
+    if (!check(dq, u, values, std::less<std::uint32_t>())) fail("deque", n);
+
+    // A comparator without a radix key permutes both ranges in place
+    auto low = [](std::uint32_t x, std::uint32_t y) { return (x & 255) < (y & 255); };
+    keys = u;
+    values = indices(n);
+    HybridSort::sort_pairs(keys.begin(), keys.end(), values.begin(), low);
+    if (!check(keys, u, values, low)) fail("comparator", n);
+}
+
+/**
+ * Sorts 64-bit keys with strings as values, which are moved, not copied.
+ */
+void testStrings(int n) {
+    std::vector<std::int64_t> keys(n), original(n);
+    std::vector<std::string> values(n);
+    for (int i = 0; i < n; i++) {
+        original[i] = keys[i] = static_cast<std::int64_t>(gen()) - (1LL << 31);
+        values[i] = std::to_string(original[i]);
+    }
+    HybridSort::sort_pairs(keys.begin(), keys.end(), values.begin());
+    for (int i = 0; i < n; i++) {
+        if (values[i] != std::to_string(keys[i])) fail("strings", n);
+        if (i > 0 && keys[i - 1] > keys[i]) fail("strings", n);
+    }
+}
+
+/**
+ * Sorts keys with values owned by unique pointers, which can only be moved.
+ */
+void testMoveOnly(int n) {
+    std::vector<std::int32_t> keys(n);
+    std::vector<std::unique_ptr<std::int32_t> > values;
+    for (int i = 0; i < n; i++) {
+        keys[i] = static_cast<std::int32_t>(gen());
+        values.emplace_back(new std::int32_t(keys[i]));
+    }
+    HybridSort::sort_pairs(keys.begin(), keys.end(), values.begin());
+    for (int i = 0; i < n; i++) {
+        if (*values[i] != keys[i]) fail("move-only", n);
+        if (i > 0 && keys[i - 1] > keys[i]) fail("move-only", n);
+    }
+}
+
+int main() {
+    for (int n = 1; n <= 1000000; n = n * 3 + 1) {
+        testPairs(n, 0xffffffff);
+        testPairs(n, 16);
+        testStrings(std::min(n, 100000));
+        testMoveOnly(std::min(n, 100000));
+    }
+    std::cout << "all tests pass" << std::endl;
+}
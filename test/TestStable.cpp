@@ -0,0 +1,169 @@
+/**
+ * Hybrid Sort Test Stable
+ *
+ * Copyright (c) 2019, xehoth
+ * All rights reserved.
+ *
+ * Licensed under the MIT License;
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author xehoth
+ */
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+#include "../HybridSort.hpp"
+
+std::mt19937 gen;
+
+struct Event {
+    int time;
+    int id;
+};
+
+struct EventLess {
+    bool operator()(const Event &x, const Event &y) const { return x.time < y.time; }
+};
+
+// Has no default constructor, so it is sorted by std::stable_sort
+struct Boxed {
+    explicit Boxed(int time, int id) : time(time), id(id) {}
+    bool operator<(const Boxed &x) const { return time < x.time; }
+    int time;
+    int id;
+};
+
+void fail(const char *name, int n) {
+    std::cout << "failed on " << name << " test, n = " << n << std::endl;
+    exit(0);
+}
+
+/**
+ * Sorts events with few distinct times, random, in sorted batches and
+ * reversed, and checks that events at the same time keep their order.
+ */
+void testEvents(int n, int times) {
+    for (int shape = 0; shape < 3; shape++) {
+        std::vector<Event> a(n);
+        for (int i = 0; i < n; i++) a[i] = {static_cast<int>(gen() % times), i};
+        if (shape == 1) {
+            for (int i = 0; i < n; i += 1000)
+                std::stable_sort(a.begin() + i, a.begin() + std::min(n, i + 1000), EventLess());
+        } else if (shape == 2) {
+            std::stable_sort(a.begin(), a.end(), EventLess());
+            std::reverse(a.begin(), a.end());
+        }
+        std::vector<Event> expected = a;
+        std::stable_sort(expected.begin(), expected.end(), EventLess());
+
+        HybridSort::stable_sort(a.begin(), a.end(), EventLess());
+        for (int i = 0; i < n; i++) {
+            if (a[i].time != expected[i].time || a[i].id != expected[i].id) fail("event", n);
+        }
+
+        std::deque<Event> d(expected.rbegin(), expected.rend());
+        HybridSort::stable_sort(d.begin(), d.end(), EventLess());
+        for (int i = 0; i < n; i++) {
+            if (d[i].time != expected[i].time) fail("deque", n);
+        }
+    }
+
+    std::vector<Boxed> b, expected;
+    for (int i = 0; i < n; i++) b.push_back(Boxed(static_cast<int>(gen() % times), i));
+    expected = b;
+    std::stable_sort(expected.begin(), expected.end());
+    HybridSort::stable_sort(b.begin(), b.end());
+    for (int i = 0; i < n; i++) {
+        if (b[i].time != expected[i].time || b[i].id != expected[i].id) fail("boxed", n);
+    }
+}
+
+/**
+ * Sorts events owned by unique pointers, which can only be moved, and
+ * checks that events at the same time keep their order.
+ */
+void testMoveOnly(int n) {
+    std::vector<std::unique_ptr<Event> > a;
+    for (int i = 0; i < n; i++) a.emplace_back(new Event{static_cast<int>(gen() % 16), i});
+    HybridSort::stable_sort(a.begin(), a.end(),
+                            [](const std::unique_ptr<Event> &x, const std::unique_ptr<Event> &y) {
+                                return x->time < y->time;
+                            });
+    for (int i = 1; i < n; i++) {
+        if (a[i - 1]->time > a[i]->time ||
+            (a[i - 1]->time == a[i]->time && a[i - 1]->id > a[i]->id))
+            fail("move-only", n);
+    }
+}
+
+/**
+ * Sorts doubles with zeros of both signs, which operator< doesn't tell
+ * apart, and checks that the zeros keep their order.
+ */
+template <typename T>
+void testZeros(int n) {
+    std::vector<T> a(n);
+    for (int i = 0; i < n; i++) {
+        const int r = static_cast<int>(gen() % 64) - 32;
+        a[i] = r == 0 ? T(-0.0) : r == 1 ? T(0.0) : static_cast<T>(r);
+    }
+    std::vector<bool> signs;
+    for (T x : a) {
+        if (x == 0) signs.push_back(std::signbit(x));
+    }
+    std::vector<T> b = a;
+    HybridSort::stable_sort(a.begin(), a.end());
+    HybridSort::stable_sort(b.begin(), b.end(), std::greater<T>());
+    std::vector<bool> signsA, signsB;
+    for (int i = 0; i < n; i++) {
+        if (a[i] == 0) signsA.push_back(std::signbit(a[i]));
+        if (b[i] == 0) signsB.push_back(std::signbit(b[i]));
+    }
+    if (!std::is_sorted(a.begin(), a.end()) || signsA != signs) fail("ascending zeros", n);
+    if (!std::is_sorted(b.begin(), b.end(), std::greater<T>()) || signsB != signs)
+        fail("descending zeros", n);
+}
+
+void testInts(int n) {
+    std::vector<int> a(n);
+    for (int i = 0; i < n; i++) a[i] = static_cast<int>(gen());
+    std::vector<int> expected = a;
+    std::sort(expected.begin(), expected.end());
+    HybridSort::stable_sort(a.begin(), a.end());
+    if (a != expected) fail("int", n);
+}
+
+int main() {
+    for (int n = 1; n <= 1000000; n = n * 3 + 1) {
+        testEvents(n, 16);
+        testEvents(n, n);
+        testMoveOnly(n);
+        testZeros<float>(n);
+        testZeros<double>(n);
+        testZeros<long double>(n);
+        testInts(n);
+    }
+    std::cout << "all tests pass" << std::endl;
+}